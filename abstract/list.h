@@ -1,8 +1,61 @@
 #ifndef LIST_H_
 #define LIST_H_
 
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
 namespace data_structures { namespace abstract {
 
+/**< Maps any well-formed types to void, for detecting expressions */
+template<typename...>
+struct voider {
+	using type = void;
+};
+
+/**< Whether L provides every list operation on its value_type */
+template<typename L, typename = void>
+struct is_list: std::false_type {};
+
+template<typename L>
+struct is_list<L, typename voider<
+		typename L::value_type,
+		decltype(std::declval<const L&>().at(std::size_t())),
+		decltype(std::declval<const L&>().back()),
+		decltype(std::declval<const L&>().front()),
+		decltype(std::declval<const L&>().size()),
+		decltype(std::declval<L&>().pop(std::size_t())),
+		decltype(std::declval<L&>().pop_back()),
+		decltype(std::declval<L&>().pop_front()),
+		decltype(std::declval<L&>().push(std::size_t(), std::declval<const typename L::value_type&>())),
+		decltype(std::declval<L&>().push(std::size_t(), std::declval<typename L::value_type&&>())),
+		decltype(std::declval<L&>().push_back(std::declval<const typename L::value_type&>())),
+		decltype(std::declval<L&>().push_back(std::declval<typename L::value_type&&>())),
+		decltype(std::declval<L&>().push_front(std::declval<const typename L::value_type&>())),
+		decltype(std::declval<L&>().push_front(std::declval<typename L::value_type&&>())),
+		decltype(std::declval<L&>().begin() != std::declval<L&>().end()),
+		decltype(std::declval<const L&>().begin() != std::declval<const L&>().end())>::type>:
+	std::integral_constant<bool,
+		std::is_convertible<decltype(std::declval<const L&>().at(std::size_t())), typename L::value_type>::value &&
+		std::is_convertible<decltype(std::declval<const L&>().size()), std::size_t>::value> {};
+
+/**
+ * Static list interface. Lists derive from it with themselves as Derived
+ * and the contract is checked once Derived is complete; calls are resolved
+ * at compile time, so generic code inlines them and T may be move-only.
+ */
+template<typename Derived, typename T>
+class static_list {
+public:
+	using value_type = T;
+
+protected:
+	~static_list() {
+		static_assert(is_list<Derived>::value, "Type does not implement the list interface.");
+	}
+};
+
+/**< Type-erased list interface, implemented by wrapping a list in virtual_list */
 template<typename T>
 class list {
 protected:
@@ -27,8 +80,11 @@ public:
 
 	/**< Insertion operations */
 	virtual void push(size_type, const T&) = 0;
+	virtual void push(size_type, T&&) = 0;
 	virtual void push_back(const T&) = 0;
+	virtual void push_back(T&&) = 0;
 	virtual void push_front(const T&) = 0;
+	virtual void push_front(T&&) = 0;
 
 	/**< Mutable iterator definition */
 	using iterator = iterator_base<T>;
@@ -41,6 +97,102 @@ public:
 	const_iterator end() const;
 };
 
+/**< Owns a List and forwards the virtual interface to it, for code that needs a runtime choice */
+template<typename List>
+class virtual_list final: public list<typename List::value_type> {
+	using T = typename List::value_type;
+	using size_type = std::size_t;
+
+public:
+	using value_type = T;
+
+	virtual_list() = default;
+
+	explicit virtual_list(List list) :
+			_list(std::move(list)) {
+	}
+
+	T at(size_type index) const override {
+		return _list.at(index);
+	}
+
+	T back() const override {
+		return _list.back();
+	}
+
+	T front() const override {
+		return _list.front();
+	}
+
+	size_type size() const override {
+		return _list.size();
+	}
+
+	T pop(size_type index) override {
+		return _list.pop(index);
+	}
+
+	T pop_back() override {
+		return _list.pop_back();
+	}
+
+	T pop_front() override {
+		return _list.pop_front();
+	}
+
+	void push(size_type index, const T& item) override {
+		_list.push(index, item);
+	}
+
+	void push(size_type index, T&& item) override {
+		_list.push(index, std::move(item));
+	}
+
+	void push_back(const T& item) override {
+		_list.push_back(item);
+	}
+
+	void push_back(T&& item) override {
+		_list.push_back(std::move(item));
+	}
+
+	void push_front(const T& item) override {
+		_list.push_front(item);
+	}
+
+	void push_front(T&& item) override {
+		_list.push_front(std::move(item));
+	}
+
+	auto begin() -> decltype(std::declval<List&>().begin()) {
+		return _list.begin();
+	}
+
+	auto end() -> decltype(std::declval<List&>().end()) {
+		return _list.end();
+	}
+
+	auto begin() const -> decltype(std::declval<const List&>().begin()) {
+		return _list.begin();
+	}
+
+	auto end() const -> decltype(std::declval<const List&>().end()) {
+		return _list.end();
+	}
+
+	/**< The wrapped list, for calls outside the interface */
+	List& get() {
+		return _list;
+	}
+
+	const List& get() const {
+		return _list;
+	}
+
+private:
+	List _list;
+};
+
 }}
 
 #endif /* LIST_H_ */
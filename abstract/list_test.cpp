@@ -0,0 +1,117 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+#include "abstract/list.h"
+#include "arrays/circular_deque/circular_deque.h"
+#include "arrays/dynamic_array/dynamic_array.h"
+#include "linked/doubly_linked_list/doubly_linked_list.h"
+#include "linked/singly_linked_list/singly_linked_list.h"
+#include "linked/skip_list/skip_list.h"
+#include "linked/unrolled_linked_list/unrolled_linked_list.h"
+
+using data_structures::abstract::is_list;
+using data_structures::abstract::list;
+using data_structures::abstract::virtual_list;
+using data_structures::arrays::circular_deque;
+using data_structures::arrays::dynamic_array;
+using data_structures::linked::doubly_linked_list;
+using data_structures::linked::indexed_skip_list;
+using data_structures::linked::singly_linked_list;
+using data_structures::linked::unrolled_linked_list;
+
+class list_test: public testing::Test {
+public:
+	virtual_list<dynamic_array<int>> array;
+	virtual_list<doubly_linked_list<int>> linked;
+};
+
+TEST_F(list_test, listsMeetTheContract) {
+	EXPECT_TRUE(is_list<circular_deque<int>>::value);
+	EXPECT_TRUE(is_list<dynamic_array<int>>::value);
+	EXPECT_TRUE(is_list<doubly_linked_list<int>>::value);
+	EXPECT_TRUE(is_list<singly_linked_list<int>>::value);
+	EXPECT_TRUE(is_list<indexed_skip_list<int>>::value);
+	EXPECT_TRUE(is_list<unrolled_linked_list<int>>::value);
+	EXPECT_TRUE(is_list<virtual_list<dynamic_array<int>>>::value);
+
+	EXPECT_FALSE(is_list<int>::value);
+	EXPECT_FALSE(is_list<std::vector<int>>::value);
+}
+
+TEST_F(list_test, listsHoldMoveOnlyItems) {
+	dynamic_array<std::unique_ptr<int>> array;
+	array.push_back(std::unique_ptr<int>(new int(42)));
+	array.emplace(0, new int(13));
+	EXPECT_EQ(13, *array.pop_front());
+
+	doubly_linked_list<std::unique_ptr<int>> linked;
+	linked.push_back(array.pop_back());
+	linked.emplace_front(new int(7));
+
+	singly_linked_list<std::unique_ptr<int>> singly;
+	singly.push_back(linked.pop_back());
+	singly.push_front(linked.pop_front());
+	EXPECT_EQ(0, linked.size());
+
+	unrolled_linked_list<std::unique_ptr<int>> unrolled;
+	unrolled.push_back(singly.pop_back());
+	unrolled.push_front(singly.pop_front());
+	EXPECT_EQ(0, singly.size());
+
+	circular_deque<std::unique_ptr<int>> deque;
+	deque.push_back(unrolled.pop_back());
+	deque.push_front(unrolled.pop_front());
+	EXPECT_EQ(0, unrolled.size());
+
+	indexed_skip_list<std::unique_ptr<int>> skip;
+	skip.push_back(deque.pop_back());
+	skip.push_front(deque.pop_front());
+	EXPECT_EQ(0, deque.size());
+
+	EXPECT_EQ(7, *skip.pop_front());
+	EXPECT_EQ(42, *skip.pop(0));
+	EXPECT_EQ(0, skip.size());
+}
+
+TEST_F(list_test, virtualListForwardsToTheWrappedList) {
+	list<int>& erased = array;
+	erased.push_back(1);
+	erased.push_front(0);
+	erased.push(2, 2);
+	EXPECT_EQ(3, erased.size());
+	EXPECT_EQ(0, erased.front());
+	EXPECT_EQ(2, erased.back());
+	EXPECT_EQ(1, erased.pop(1));
+	EXPECT_THROW(erased.at(2), std::out_of_range);
+
+	EXPECT_TRUE(array.get() == dynamic_array<int>({ 0, 2 }));
+	EXPECT_GE(array.get().capacity(), 2);
+}
+
+TEST_F(list_test, implementationIsChosenAtRuntime) {
+	std::vector<list<int>*> lists { &array, &linked };
+	for (auto erased : lists)
+		for (int i = 0; i < 10; ++i)
+			erased->push_back(i);
+
+	EXPECT_TRUE(std::equal(array.begin(), array.end(), linked.begin()));
+	for (auto erased : lists) {
+		EXPECT_EQ(0, erased->pop_front());
+		EXPECT_EQ(9, erased->pop_back());
+		EXPECT_EQ(8, erased->size());
+	}
+}
+
+TEST_F(list_test, virtualListWrapsAnExistingList) {
+	singly_linked_list<int> items;
+	for (int i = 1; i <= 3; ++i)
+		items.push_back(i);
+	virtual_list<singly_linked_list<int>> wrapped(std::move(items));
+	const list<int>& erased = wrapped;
+	EXPECT_EQ(3, erased.size());
+	EXPECT_EQ(2, erased.at(1));
+
+	int expected = 1;
+	for (int item : wrapped)
+		EXPECT_EQ(expected++, item);
+}
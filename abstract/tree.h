@@ -5,7 +5,49 @@
 
 namespace data_structures { namespace abstract {
 
-template<typename T, template<typename> class Container = list>
+/**< Whether Tr provides every tree operation on its value_type */
+template<typename Tr, typename = void>
+struct is_tree: std::false_type {};
+
+template<typename Tr>
+struct is_tree<Tr, typename voider<
+		typename Tr::value_type,
+		decltype(std::declval<const Tr&>().has(std::declval<const typename Tr::value_type&>())),
+		decltype(std::declval<const Tr&>().size()),
+		decltype(std::declval<Tr&>().insert(std::declval<const typename Tr::value_type&>())),
+		decltype(std::declval<Tr&>().insert(std::declval<typename Tr::value_type&&>())),
+		decltype(std::declval<Tr&>().remove(std::declval<const typename Tr::value_type&>())),
+		decltype(std::declval<const Tr&>().in_order()),
+		decltype(std::declval<const Tr&>().pre_order()),
+		decltype(std::declval<const Tr&>().post_order())>::type>:
+	std::integral_constant<bool,
+		std::is_convertible<decltype(std::declval<const Tr&>().has(
+				std::declval<const typename Tr::value_type&>())), bool>::value &&
+		std::is_convertible<decltype(std::declval<const Tr&>().size()), std::size_t>::value &&
+		std::is_convertible<decltype(std::declval<const Tr&>().in_order()),
+				typename Tr::template container<typename Tr::value_type>>::value> {};
+
+/**
+ * Static tree interface, the counterpart of static_list: Derived is checked
+ * against the contract at compile time and nothing is dispatched virtually.
+ */
+template<typename Derived, typename T, template<typename...> class Container = list>
+class static_tree {
+public:
+	using value_type = T;
+
+	/**< The list type traversals return */
+	template<typename... Args>
+	using container = Container<Args...>;
+
+protected:
+	~static_tree() {
+		static_assert(is_tree<Derived>::value, "Type does not implement the tree interface.");
+	}
+};
+
+/**< Type-erased tree interface, implemented by wrapping a tree in virtual_tree */
+template<typename T, template<typename...> class Container = list>
 class tree {
 protected:
 	using size_type = std::size_t;
@@ -17,6 +59,7 @@ public:
 	virtual size_type size() const = 0;
 
 	virtual void insert(const T& item) = 0;
+	virtual void insert(T&& item) = 0;
 	virtual void remove(const T& item) = 0;
 
 	virtual Container<T> in_order() const = 0;
@@ -24,6 +67,76 @@ public:
 	virtual Container<T> post_order() const = 0;
 };
 
+/**
+ * Owns a Tree and forwards the virtual interface to it. Container repeats
+ * the list type the tree's traversals return, as alias templates cannot
+ * stand in for the template itself.
+ */
+template<typename Tree, template<typename...> class Container>
+class virtual_tree final: public tree<typename Tree::value_type, Container> {
+	using T = typename Tree::value_type;
+	using size_type = std::size_t;
+
+	static_assert(std::is_same<typename Tree::template container<T>, Container<T>>::value,
+			"Container differs from the one the tree traverses into.");
+
+public:
+	using value_type = T;
+
+	template<typename... Args>
+	using container = Container<Args...>;
+
+	virtual_tree() = default;
+
+	explicit virtual_tree(Tree tree) :
+			_tree(std::move(tree)) {
+	}
+
+	bool has(const T& item) const override {
+		return _tree.has(item);
+	}
+
+	size_type size() const override {
+		return _tree.size();
+	}
+
+	void insert(const T& item) override {
+		_tree.insert(item);
+	}
+
+	void insert(T&& item) override {
+		_tree.insert(std::move(item));
+	}
+
+	void remove(const T& item) override {
+		_tree.remove(item);
+	}
+
+	Container<T> in_order() const override {
+		return _tree.in_order();
+	}
+
+	Container<T> pre_order() const override {
+		return _tree.pre_order();
+	}
+
+	Container<T> post_order() const override {
+		return _tree.post_order();
+	}
+
+	/**< The wrapped tree, for calls outside the interface */
+	Tree& get() {
+		return _tree;
+	}
+
+	const Tree& get() const {
+		return _tree;
+	}
+
+private:
+	Tree _tree;
+};
+
 }}
 
 #endif /* TREE_H_ */
@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+#include <set>
+#include <string>
+#include "abstract/tree.h"
+#include "linked/doubly_linked_list/doubly_linked_list.h"
+#include "linked/skip_list/skip_list.h"
+#include "trees/avl_tree/avl_tree.h"
+#include "trees/b_tree/b_tree.h"
+#include "trees/concurrent_avl_tree/concurrent_avl_tree.h"
+
+using data_structures::abstract::is_tree;
+using data_structures::abstract::tree;
+using data_structures::abstract::virtual_tree;
+using data_structures::linked::doubly_linked_list;
+using data_structures::linked::skip_list;
+using data_structures::trees::avl_tree;
+using data_structures::trees::b_tree;
+using data_structures::trees::concurrent_avl_tree;
+
+/**< The interface every tree in this fixture is erased to */
+using int_tree = tree<int, doubly_linked_list>;
+using virtual_avl = virtual_tree<avl_tree<int>, doubly_linked_list>;
+
+class tree_test: public testing::Test {
+public:
+	virtual_avl avl;
+	virtual_tree<b_tree<int>, doubly_linked_list> b;
+};
+
+TEST_F(tree_test, treesMeetTheContract) {
+	EXPECT_TRUE(is_tree<avl_tree<int>>::value);
+	EXPECT_TRUE(is_tree<b_tree<int>>::value);
+	EXPECT_TRUE(is_tree<concurrent_avl_tree<int>>::value);
+	EXPECT_TRUE(is_tree<skip_list<int>>::value);
+	EXPECT_TRUE(is_tree<virtual_avl>::value);
+
+	EXPECT_FALSE(is_tree<int>::value);
+	EXPECT_FALSE(is_tree<std::set<int>>::value);
+}
+
+TEST_F(tree_test, virtualTreeForwardsToTheWrappedTree) {
+	int_tree& erased = avl;
+	erased.insert(42);
+	erased.insert(13);
+	erased.insert(1963);
+	EXPECT_TRUE(erased.has(13));
+	erased.remove(13);
+	EXPECT_FALSE(erased.has(13));
+	EXPECT_EQ(2, erased.size());
+	EXPECT_THROW(erased.remove(13), std::exception);
+	EXPECT_EQ(42, avl.get().select(0));
+}
+
+TEST_F(tree_test, implementationIsChosenAtRuntime) {
+	int_tree* trees[] = { &avl, &b };
+	for (auto erased : trees)
+		for (int key : { 5, 3, 8, 1, 4 })
+			erased->insert(key);
+
+	EXPECT_TRUE(avl.in_order() == b.in_order());
+	EXPECT_TRUE(avl.in_order() == doubly_linked_list<int>({ 1, 3, 4, 5, 8 }));
+}
+
+TEST_F(tree_test, virtualTreeWrapsAnExistingTree) {
+	skip_list<std::string> names;
+	names.insert("b");
+	names.insert("a");
+	virtual_tree<skip_list<std::string>, doubly_linked_list> wrapped(std::move(names));
+	const tree<std::string, doubly_linked_list>& erased = wrapped;
+	EXPECT_EQ(2, erased.size());
+	EXPECT_TRUE(erased.has("a"));
+	EXPECT_EQ("a", erased.in_order().front());
+}
@@ -0,0 +1,483 @@
+#ifndef CIRCULAR_DEQUE_H_
+#define CIRCULAR_DEQUE_H_
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "abstract/list.h"
+
+namespace data_structures {
+namespace arrays {
+
+using abstract::static_list;
+
+/**
+ * Ring buffer list: pushing and popping at either end and at() are O(1),
+ * pushing and popping elsewhere shift the shorter side.
+ *
+ * With Capacity left at zero the buffer lives on the heap and doubles when
+ * full. Any other Capacity makes the buffer part of the deque itself, so it
+ * never allocates; pushing onto a full one throws std::length_error, which
+ * full() lets callers avoid. Moving such a deque moves its items one by one.
+ */
+template<typename T, std::size_t Capacity = 0, typename Allocator = std::allocator<T>>
+class circular_deque: public static_list<circular_deque<T, Capacity, Allocator>, T> {
+private:
+	using size_type = std::size_t;
+	using storage = typename std::aligned_storage<sizeof(T), alignof(T)>::type;
+
+	template<typename NodeT>
+	class iterator_base {
+		using owner = typename std::conditional<std::is_const<NodeT>::value,
+				const circular_deque, circular_deque>::type;
+
+	public:
+		using iterator_category = std::bidirectional_iterator_tag;
+		using value_type = typename std::remove_const<NodeT>::type;
+		using difference_type = std::ptrdiff_t;
+		using pointer = NodeT*;
+		using reference = NodeT&;
+
+		iterator_base(owner* deque, size_type index) :
+				_deque(deque), _index(index) {
+		}
+
+		iterator_base& operator++() {
+			if (_index == _deque->_size)
+				throw std::out_of_range("Iterating beyond list end.");
+			++_index;
+			return *this;
+		}
+
+		iterator_base operator++(int) {
+			iterator_base old = *this;
+			++(*this);
+			return old;
+		}
+
+		iterator_base& operator--() {
+			if (_index == 0)
+				throw std::out_of_range("Iterating beyond list begin.");
+			--_index;
+			return *this;
+		}
+
+		iterator_base operator--(int) {
+			iterator_base old = *this;
+			--(*this);
+			return old;
+		}
+
+		bool operator==(const iterator_base& other) const {
+			return _index == other._index && _deque == other._deque;
+		}
+
+		bool operator!=(const iterator_base& other) const {
+			return !(*this == other);
+		}
+
+		NodeT& operator*() const {
+			return _deque->element(_index);
+		}
+
+		NodeT* operator->() const {
+			return &_deque->element(_index);
+		}
+
+	private:
+		owner* _deque;
+		size_type _index;
+	};
+
+	using init_list = std::initializer_list<T>;
+	using self = circular_deque<T, Capacity, Allocator>;
+	using parent = static_list<self, T>;
+	using traits = std::allocator_traits<Allocator>;
+
+	static constexpr bool fixed = Capacity != 0;
+	static constexpr size_type min_capacity = 8;
+
+public:
+	using allocator_type = Allocator;
+
+	circular_deque() :
+			_data(fixed ? reinterpret_cast<T*>(_inline.data()) : nullptr), _capacity(Capacity) {
+	}
+
+	circular_deque(const self& other) :
+			circular_deque() {
+		_alloc = traits::select_on_container_copy_construction(other._alloc);
+		reserve(other._size);
+		for (const T& item : other)
+			emplace_back(item);
+	}
+
+	circular_deque(self&& other) :
+			circular_deque() {
+		take(other);
+	}
+
+	circular_deque(const init_list& items) :
+			circular_deque() {
+		reserve(items.size());
+		for (const T& item : items)
+			emplace_back(item);
+	}
+
+	~circular_deque() {
+		clear();
+		if (!fixed && _data != nullptr)
+			traits::deallocate(_alloc, _data, _capacity);
+	}
+
+	T at(size_type position) const {
+		if (position >= _size)
+			throw std::out_of_range("Out of range access.");
+
+		return element(position);
+	}
+
+	T back() const {
+		empty_check();
+
+		return element(_size - 1);
+	}
+
+	T front() const {
+		empty_check();
+
+		return element(0);
+	}
+
+	size_type size() const {
+		return _size;
+	}
+
+	size_type capacity() const {
+		return _capacity;
+	}
+
+	/**< Whether the next push would throw, which only happens with a fixed capacity */
+	bool full() const {
+		return fixed && _size == _capacity;
+	}
+
+	/**< Removal operations */
+	T pop(size_type position) {
+		if (position >= _size)
+			throw std::out_of_range("Empty list.");
+
+		T item = std::move(element(position));
+		if (position < _size / 2) {
+			for (size_type i = position; i > 0; --i)
+				element(i) = std::move(element(i - 1));
+			drop_front();
+		} else {
+			for (size_type i = position; i + 1 < _size; ++i)
+				element(i) = std::move(element(i + 1));
+			drop_back();
+		}
+		return item;
+	}
+
+	T pop_back() {
+		empty_check();
+
+		T item = std::move(element(_size - 1));
+		drop_back();
+		return item;
+	}
+
+	T pop_front() {
+		empty_check();
+
+		T item = std::move(element(0));
+		drop_front();
+		return item;
+	}
+
+	/**< Destroys every item, keeping the buffer */
+	void clear() {
+		while (_size > 0)
+			drop_back();
+		_head = 0;
+	}
+
+	/**< Insertion operations */
+	void push(size_type position, const T& item) {
+		emplace(position, item);
+	}
+
+	void push(size_type position, T&& item) {
+		emplace(position, std::move(item));
+	}
+
+	void push_back(const T& item) {
+		emplace_back(item);
+	}
+
+	void push_back(T&& item) {
+		emplace_back(std::move(item));
+	}
+
+	void push_front(const T& item) {
+		emplace_front(item);
+	}
+
+	void push_front(T&& item) {
+		emplace_front(std::move(item));
+	}
+
+	/**< Builds the item out of args and shifts whichever side is shorter */
+	template<typename... Args>
+	void emplace(size_type position, Args&&... args) {
+		if (position > _size)
+			throw std::out_of_range("Out of range access.");
+
+		if (position == 0) {
+			emplace_front(std::forward<Args>(args)...);
+			return;
+		}
+
+		if (position == _size) {
+			emplace_back(std::forward<Args>(args)...);
+			return;
+		}
+
+		// Built first, as args may refer to an item about to be shifted.
+		T item(std::forward<Args>(args)...);
+		if (position < _size / 2) {
+			emplace_front(std::move(element(0)));
+			for (size_type i = 1; i < position; ++i)
+				element(i) = std::move(element(i + 1));
+		} else {
+			emplace_back(std::move(element(_size - 1)));
+			for (size_type i = _size - 2; i > position; --i)
+				element(i) = std::move(element(i - 1));
+		}
+		element(position) = std::move(item);
+	}
+
+	template<typename... Args>
+	void emplace_back(Args&&... args) {
+		if (_size == _capacity) {
+			// Built before the buffer moves, in case args refer to an item in it.
+			T item(std::forward<Args>(args)...);
+			grow();
+			traits::construct(_alloc, &element(_size), std::move(item));
+		} else {
+			traits::construct(_alloc, &element(_size), std::forward<Args>(args)...);
+		}
+		++_size;
+	}
+
+	template<typename... Args>
+	void emplace_front(Args&&... args) {
+		if (_size == _capacity) {
+			T item(std::forward<Args>(args)...);
+			grow();
+			traits::construct(_alloc, _data + before(_head), std::move(item));
+		} else {
+			traits::construct(_alloc, _data + before(_head), std::forward<Args>(args)...);
+		}
+		_head = before(_head);
+		++_size;
+	}
+
+	/**< Makes room for n items in total; a fixed deque only checks it has it */
+	void reserve(size_type n) {
+		if (n <= _capacity)
+			return;
+
+		if (fixed)
+			throw std::length_error("Full list.");
+
+		reallocate(n);
+	}
+
+	/**< Gives back the capacity beyond size(), unless it is fixed */
+	void shrink_to_fit() {
+		if (fixed || _capacity == _size)
+			return;
+
+		if (_size == 0) {
+			traits::deallocate(_alloc, _data, _capacity);
+			_data = nullptr;
+			_capacity = _head = 0;
+			return;
+		}
+
+		reallocate(_size);
+	}
+
+	using iterator = iterator_base<T>;
+
+	iterator begin() {
+		return {this, 0};
+	}
+
+	iterator end() {
+		return {this, _size};
+	}
+
+	using const_iterator = iterator_base<const T>;
+
+	const_iterator begin() const {
+		return {this, 0};
+	}
+
+	const_iterator end() const {
+		return {this, _size};
+	}
+
+	self& operator=(const self& rhs) {
+		self copy(rhs);
+		swap(*this, copy);
+		return *this;
+	}
+
+	self& operator=(self&& rhs) {
+		if (fixed) {
+			clear();
+			take(rhs);
+		} else {
+			swap(*this, rhs);
+		}
+		return *this;
+	}
+
+	bool operator==(const self& rhs) const {
+		return _size == rhs._size && std::equal(begin(), end(), rhs.begin());
+	}
+
+	bool operator==(const init_list& rhs) const {
+		return _size == rhs.size() && std::equal(begin(), end(), rhs.begin());
+	}
+
+	bool operator!=(const self& rhs) const {
+		return !(*this == rhs);
+	}
+
+	friend void swap(self& a, self& b) {
+		using std::swap;
+
+		if (fixed) {
+			self held(std::move(a));
+			a = std::move(b);
+			b = std::move(held);
+			return;
+		}
+
+		swap(a._data, b._data);
+		swap(a._head, b._head);
+		swap(a._size, b._size);
+		swap(a._capacity, b._capacity);
+		swap(a._alloc, b._alloc);
+	}
+
+private:
+	void empty_check() const {
+		if (!_size)
+			throw std::out_of_range("Empty list.");
+	}
+
+	/**< The item position items away from the front, wrapped around the buffer */
+	T& element(size_type position) const {
+		position += _head;
+		return _data[position < _capacity ? position : position - _capacity];
+	}
+
+	size_type before(size_type slot) const {
+		return (slot == 0 ? _capacity : slot) - 1;
+	}
+
+	void drop_front() {
+		traits::destroy(_alloc, &element(0));
+		_head = _head + 1 == _capacity ? 0 : _head + 1;
+		--_size;
+	}
+
+	void drop_back() {
+		traits::destroy(_alloc, &element(_size - 1));
+		--_size;
+	}
+
+	void grow() {
+		if (fixed)
+			throw std::length_error("Full list.");
+
+		reallocate(_capacity ? 2 * _capacity : size_type(min_capacity));
+	}
+
+	/**< Moves the items, unwrapped, to the front of a fresh buffer for capacity of them */
+	void reallocate(size_type capacity) {
+		T* data = traits::allocate(_alloc, capacity);
+		try {
+			move_items(data, std::is_trivially_copyable<T>());
+		} catch (...) {
+			traits::deallocate(_alloc, data, capacity);
+			throw;
+		}
+
+		if (_data != nullptr)
+			traits::deallocate(_alloc, _data, _capacity);
+		_data = data;
+		_capacity = capacity;
+		_head = 0;
+	}
+
+	void move_items(T* data, std::true_type) {
+		// At most two runs: from the head to the buffer end, then the wrapped part.
+		size_type first = std::min(_size, _capacity - _head);
+		if (first)
+			std::memcpy(static_cast<void*>(data), _data + _head, first * sizeof(T));
+		if (_size > first)
+			std::memcpy(static_cast<void*>(data + first), _data, (_size - first) * sizeof(T));
+	}
+
+	/**< Moves if that cannot throw, copies otherwise, so a failure leaves the originals intact */
+	void move_items(T* data, std::false_type) {
+		size_type moved = 0;
+		try {
+			for (; moved < _size; ++moved)
+				traits::construct(_alloc, data + moved, std::move_if_noexcept(element(moved)));
+		} catch (...) {
+			while (moved > 0)
+				traits::destroy(_alloc, data + --moved);
+			throw;
+		}
+		for (size_type i = 0; i < _size; ++i)
+			traits::destroy(_alloc, &element(i));
+	}
+
+	/**< Takes the items of other, leaving it empty; this must be empty too */
+	void take(self& other) {
+		if (fixed) {
+			for (T& item : other)
+				emplace_back(std::move(item));
+			other.clear();
+			return;
+		}
+
+		swap(*this, other);
+	}
+
+	Allocator _alloc;
+	std::array<storage, Capacity> _inline;
+	T* _data;
+	size_type _head { 0 };
+	size_type _size { 0 };
+	size_type _capacity;
+};
+
+}
+}
+
+#endif /* CIRCULAR_DEQUE_H_ */
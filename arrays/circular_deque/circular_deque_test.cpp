@@ -0,0 +1,194 @@
+#include <gtest/gtest.h>
+#include <deque>
+#include <random>
+#include <string>
+#include "circular_deque.h"
+
+using data_structures::arrays::circular_deque;
+
+using fixed_deque = circular_deque<int, 4>;
+
+class circular_deque_test: public testing::Test {
+public:
+	circular_deque<int> deque;
+};
+
+TEST_F(circular_deque_test, isCreatedEmpty) {
+	EXPECT_EQ(0, deque.size());
+	EXPECT_EQ(0, deque.capacity());
+	EXPECT_FALSE(deque.full());
+	EXPECT_THROW(deque.front(), std::out_of_range);
+	EXPECT_THROW(deque.back(), std::out_of_range);
+}
+
+TEST_F(circular_deque_test, pushesOnBothEnds) {
+	deque.push_back(2);
+	deque.push_front(1);
+	deque.push_back(3);
+	deque.push_front(0);
+	EXPECT_TRUE(deque == circular_deque<int>({ 0, 1, 2, 3 }));
+	EXPECT_EQ(0, deque.front());
+	EXPECT_EQ(3, deque.back());
+	EXPECT_EQ(2, deque.at(2));
+	EXPECT_THROW(deque.at(4), std::out_of_range);
+}
+
+TEST_F(circular_deque_test, popsFromBothEnds) {
+	deque = { 0, 1, 2, 3 };
+	EXPECT_EQ(0, deque.pop_front());
+	EXPECT_EQ(3, deque.pop_back());
+	EXPECT_EQ(1, deque.pop_front());
+	EXPECT_EQ(2, deque.pop_back());
+	EXPECT_THROW(deque.pop_front(), std::out_of_range);
+	EXPECT_THROW(deque.pop_back(), std::out_of_range);
+}
+
+TEST_F(circular_deque_test, wrapsAroundWithoutGrowing) {
+	for (int i = 0; i < 6; ++i)
+		deque.push_back(i);
+	const auto capacity = deque.capacity();
+
+	// Slide a window of six items twice around the buffer.
+	for (int i = 6; i < 6 + 2 * static_cast<int>(capacity); ++i) {
+		EXPECT_EQ(i - 6, deque.pop_front());
+		deque.push_back(i);
+		EXPECT_EQ(i - 5, deque.at(0));
+		EXPECT_EQ(i, deque.at(5));
+	}
+	EXPECT_EQ(capacity, deque.capacity());
+}
+
+TEST_F(circular_deque_test, growsWhileWrapped) {
+	for (int i = 0; i < 5; ++i)
+		deque.push_back(i);
+	for (int i = -1; i >= -20; --i)
+		deque.push_front(i);
+
+	int expected = -20;
+	for (int item : deque)
+		EXPECT_EQ(expected++, item);
+	EXPECT_EQ(5, expected);
+}
+
+TEST_F(circular_deque_test, pushAndPopInTheMiddle) {
+	deque = { 0, 1, 3, 4, 5, 6 };
+	deque.push(2, 2);
+	deque.push(6, 42);
+	EXPECT_TRUE(deque == circular_deque<int>({ 0, 1, 2, 3, 4, 5, 42, 6 }));
+	EXPECT_EQ(42, deque.pop(6));
+	EXPECT_EQ(1, deque.pop(1));
+	EXPECT_TRUE(deque == circular_deque<int>({ 0, 2, 3, 4, 5, 6 }));
+	EXPECT_THROW(deque.push(7, 42), std::out_of_range);
+	EXPECT_THROW(deque.pop(6), std::out_of_range);
+}
+
+TEST_F(circular_deque_test, randomOperationsMatchStdDeque) {
+	std::deque<int> reference;
+	std::mt19937 random(42);
+	for (int i = 0; i < 5000; ++i) {
+		std::size_t position = reference.empty() ? 0 : random() % (reference.size() + 1);
+		switch (random() % 6) {
+		case 0:
+			deque.push_front(i);
+			reference.push_front(i);
+			break;
+		case 1:
+		case 2:
+			deque.push_back(i);
+			reference.push_back(i);
+			break;
+		case 3:
+			deque.push(position, i);
+			reference.insert(reference.begin() + position, i);
+			break;
+		case 4:
+			if (!reference.empty()) {
+				EXPECT_EQ(reference.front(), deque.pop_front());
+				reference.pop_front();
+			}
+			break;
+		default:
+			if (position < reference.size()) {
+				EXPECT_EQ(reference[position], deque.pop(position));
+				reference.erase(reference.begin() + position);
+			}
+		}
+		ASSERT_EQ(reference.size(), deque.size());
+	}
+	EXPECT_TRUE(std::equal(reference.begin(), reference.end(), deque.begin()));
+}
+
+TEST_F(circular_deque_test, pushOfOwnItemSurvivesGrowth) {
+	circular_deque<std::string> strings { "first" };
+	strings.shrink_to_fit();
+	strings.push_back(strings.front());
+	strings.push_front(*strings.begin());
+	EXPECT_EQ(3, strings.size());
+	for (const auto& item : strings)
+		EXPECT_EQ("first", item);
+}
+
+TEST_F(circular_deque_test, reserveAndShrinkToFit) {
+	deque.reserve(100);
+	EXPECT_EQ(100, deque.capacity());
+	for (int i = 0; i < 10; ++i)
+		deque.push_front(i);
+	deque.shrink_to_fit();
+	EXPECT_EQ(10, deque.capacity());
+	EXPECT_EQ(9, deque.front());
+	EXPECT_EQ(0, deque.back());
+
+	deque.clear();
+	deque.shrink_to_fit();
+	EXPECT_EQ(0, deque.capacity());
+}
+
+TEST_F(circular_deque_test, fixedCapacityNeverGrows) {
+	fixed_deque fixed;
+	EXPECT_EQ(4, fixed.capacity());
+	fixed.push_back(1);
+	fixed.push_back(2);
+	fixed.push_front(0);
+	fixed.push_back(3);
+	EXPECT_TRUE(fixed.full());
+	EXPECT_THROW(fixed.push_back(4), std::length_error);
+	EXPECT_THROW(fixed.push_front(4), std::length_error);
+	EXPECT_THROW(fixed.reserve(5), std::length_error);
+
+	EXPECT_EQ(0, fixed.pop_front());
+	fixed.push_back(4);
+	EXPECT_TRUE(fixed == fixed_deque({ 1, 2, 3, 4 }));
+}
+
+TEST_F(circular_deque_test, fixedCapacityMovesItemByItem) {
+	circular_deque<std::string, 4> strings;
+	strings.emplace_back(48, 'b');
+	strings.emplace_front(48, 'a');
+
+	circular_deque<std::string, 4> moved(std::move(strings));
+	EXPECT_EQ(0, strings.size());
+	EXPECT_EQ(2, moved.size());
+	EXPECT_EQ(std::string(48, 'b'), moved.pop_back());
+
+	fixed_deque a { 1, 2 }, b { 3 };
+	swap(a, b);
+	EXPECT_TRUE(a == fixed_deque({ 3 }));
+	EXPECT_TRUE(b == fixed_deque({ 1, 2 }));
+	a = b;
+	EXPECT_TRUE(a == b);
+}
+
+TEST_F(circular_deque_test, copyAndMove) {
+	for (int i = 0; i < 20; ++i)
+		deque.push_front(i);
+	circular_deque<int> copy(deque);
+	EXPECT_TRUE(copy == deque);
+	copy.pop_back();
+	EXPECT_TRUE(copy != deque);
+
+	circular_deque<int> moved(std::move(copy));
+	EXPECT_EQ(0, copy.size());
+	EXPECT_EQ(19, moved.size());
+	deque = moved;
+	EXPECT_TRUE(deque == moved);
+}
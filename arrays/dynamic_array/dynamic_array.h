@@ -0,0 +1,361 @@
+#ifndef DYNAMIC_ARRAY_H_
+#define DYNAMIC_ARRAY_H_
+
+#include <algorithm>
+#include <cstring>
+#include <initializer_list>
+#include <memory>
+#include <ratio>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "abstract/list.h"
+
+namespace data_structures {
+namespace arrays {
+
+using abstract::static_list;
+
+/**
+ * Contiguous list, growing its storage geometrically so push_back() is
+ * amortized O(1) and at() is a single index.
+ *
+ * Growth is a std::ratio above one; each reallocation multiplies the
+ * capacity by it. Items are relocated with memcpy when trivially copyable,
+ * otherwise moved if that cannot throw and copied if it can, so a failed
+ * reallocation leaves the array untouched.
+ */
+template<typename T, typename Allocator = std::allocator<T>, typename Growth = std::ratio<3, 2>>
+class dynamic_array: public static_list<dynamic_array<T, Allocator, Growth>, T> {
+	static_assert(Growth::num > Growth::den, "Growth factor must be greater than one.");
+
+private:
+	using init_list = std::initializer_list<T>;
+	using self = dynamic_array<T, Allocator, Growth>;
+	using parent = static_list<self, T>;
+	using size_type = std::size_t;
+	using traits = std::allocator_traits<Allocator>;
+
+public:
+	using allocator_type = Allocator;
+	using growth = Growth;
+
+	dynamic_array() = default;
+
+	dynamic_array(const self& other) :
+			_alloc(traits::select_on_container_copy_construction(other._alloc)) {
+		reserve(other._size);
+		for (const T& item : other)
+			emplace_back(item);
+	}
+
+	dynamic_array(self&& other) {
+		swap(*this, other);
+	}
+
+	dynamic_array(const init_list& items) {
+		reserve(items.size());
+		for (const T& item : items)
+			emplace_back(item);
+	}
+
+	~dynamic_array() {
+		release();
+	}
+
+	T at(size_type position) const {
+		if (position >= _size)
+			throw std::out_of_range("Out of range access.");
+
+		return _data[position];
+	}
+
+	T back() const {
+		empty_check();
+
+		return _data[_size - 1];
+	}
+
+	T front() const {
+		empty_check();
+
+		return _data[0];
+	}
+
+	size_type size() const {
+		return _size;
+	}
+
+	size_type capacity() const {
+		return _capacity;
+	}
+
+	/**< Unchecked access, for when the position is known to be valid */
+	T& operator[](size_type position) {
+		return _data[position];
+	}
+
+	const T& operator[](size_type position) const {
+		return _data[position];
+	}
+
+	T* data() {
+		return _data;
+	}
+
+	const T* data() const {
+		return _data;
+	}
+
+	/**< Removal operations */
+	T pop(size_type position) {
+		if (position >= _size)
+			throw std::out_of_range("Empty list.");
+
+		T item = std::move(_data[position]);
+		std::move(_data + position + 1, _data + _size, _data + position);
+		traits::destroy(_alloc, _data + --_size);
+		return item;
+	}
+
+	T pop_back() {
+		empty_check();
+
+		T item = std::move(_data[_size - 1]);
+		traits::destroy(_alloc, _data + --_size);
+		return item;
+	}
+
+	T pop_front() {
+		empty_check();
+
+		return pop(0);
+	}
+
+	/**< Destroys every item but keeps the storage */
+	void clear() {
+		destroy_items();
+		_size = 0;
+	}
+
+	/**< Insertion operations */
+	void push(size_type position, const T& item) {
+		emplace(position, item);
+	}
+
+	void push(size_type position, T&& item) {
+		emplace(position, std::move(item));
+	}
+
+	void push_back(const T& item) {
+		emplace_back(item);
+	}
+
+	void push_back(T&& item) {
+		emplace_back(std::move(item));
+	}
+
+	void push_front(const T& item) {
+		emplace(0, item);
+	}
+
+	void push_front(T&& item) {
+		emplace(0, std::move(item));
+	}
+
+	/**< Builds the item out of args and shifts the tail one slot right for it */
+	template<typename... Args>
+	void emplace(size_type position, Args&&... args) {
+		if (position > _size)
+			throw std::out_of_range("Out of range access.");
+
+		if (position == _size) {
+			emplace_back(std::forward<Args>(args)...);
+			return;
+		}
+
+		// Built first, as args may refer to an item about to be shifted.
+		T item(std::forward<Args>(args)...);
+		emplace_back(std::move(_data[_size - 1]));
+		std::move_backward(_data + position, _data + _size - 2, _data + _size - 1);
+		_data[position] = std::move(item);
+	}
+
+	template<typename... Args>
+	void emplace_back(Args&&... args) {
+		if (_size < _capacity) {
+			traits::construct(_alloc, _data + _size, std::forward<Args>(args)...);
+			++_size;
+			return;
+		}
+
+		// The new item goes in before the old ones move, in case args refer to them.
+		size_type capacity = grown(_size + 1);
+		T* data = traits::allocate(_alloc, capacity);
+		try {
+			traits::construct(_alloc, data + _size, std::forward<Args>(args)...);
+			try {
+				move_items(data, std::is_trivially_copyable<T>());
+			} catch (...) {
+				traits::destroy(_alloc, data + _size);
+				throw;
+			}
+		} catch (...) {
+			traits::deallocate(_alloc, data, capacity);
+			throw;
+		}
+		adopt(data, capacity);
+		++_size;
+	}
+
+	/**< Makes room for n items in total, so pushing up to that never reallocates */
+	void reserve(size_type n) {
+		if (n > _capacity)
+			reallocate(n);
+	}
+
+	/**< Gives back the capacity beyond size() */
+	void shrink_to_fit() {
+		if (_capacity == _size)
+			return;
+
+		if (_size == 0) {
+			release();
+			_data = nullptr;
+			_capacity = 0;
+			return;
+		}
+
+		reallocate(_size);
+	}
+
+	using iterator = T*;
+
+	iterator begin() {
+		return _data;
+	}
+
+	iterator end() {
+		return _data + _size;
+	}
+
+	using const_iterator = const T*;
+
+	const_iterator begin() const {
+		return _data;
+	}
+
+	const_iterator end() const {
+		return _data + _size;
+	}
+
+	self& operator=(const self& rhs) {
+		self copy(rhs);
+		swap(*this, copy);
+		return *this;
+	}
+
+	self& operator=(self&& rhs) {
+		swap(*this, rhs);
+		return *this;
+	}
+
+	bool operator==(const self& rhs) const {
+		return _size == rhs._size && std::equal(begin(), end(), rhs.begin());
+	}
+
+	bool operator==(const init_list& rhs) const {
+		return _size == rhs.size() && std::equal(begin(), end(), rhs.begin());
+	}
+
+	bool operator!=(const self& rhs) const {
+		return !(*this == rhs);
+	}
+
+	friend void swap(self& a, self& b) {
+		using std::swap;
+
+		swap(a._data, b._data);
+		swap(a._size, b._size);
+		swap(a._capacity, b._capacity);
+		swap(a._alloc, b._alloc);
+	}
+
+private:
+	void empty_check() const {
+		if (!_size)
+			throw std::out_of_range("Empty list.");
+	}
+
+	/**< Capacity after growing to hold at least needed items */
+	size_type grown(size_type needed) const {
+		size_type capacity = _capacity / Growth::den * Growth::num
+				+ _capacity % Growth::den * Growth::num / Growth::den;
+		if (capacity < _capacity || capacity > traits::max_size(_alloc))
+			capacity = traits::max_size(_alloc);
+		if (needed > traits::max_size(_alloc))
+			throw std::length_error("Array too long.");
+		return std::max(capacity, needed);
+	}
+
+	/**< Moves the items into fresh storage for capacity of them */
+	void reallocate(size_type capacity) {
+		T* data = traits::allocate(_alloc, capacity);
+		try {
+			move_items(data, std::is_trivially_copyable<T>());
+		} catch (...) {
+			traits::deallocate(_alloc, data, capacity);
+			throw;
+		}
+		adopt(data, capacity);
+	}
+
+	void move_items(T* data, std::true_type) {
+		if (_size)
+			std::memcpy(static_cast<void*>(data), _data, _size * sizeof(T));
+	}
+
+	/**< Moves if that cannot throw, copies otherwise, so a failure leaves the originals intact */
+	void move_items(T* data, std::false_type) {
+		size_type moved = 0;
+		try {
+			for (; moved < _size; ++moved)
+				traits::construct(_alloc, data + moved, std::move_if_noexcept(_data[moved]));
+		} catch (...) {
+			while (moved > 0)
+				traits::destroy(_alloc, data + --moved);
+			throw;
+		}
+		destroy_items();
+	}
+
+	/**< Swaps in storage the items were just moved to */
+	void adopt(T* data, size_type capacity) {
+		if (_data != nullptr)
+			traits::deallocate(_alloc, _data, _capacity);
+		_data = data;
+		_capacity = capacity;
+	}
+
+	void destroy_items() {
+		if (!std::is_trivially_destructible<T>::value)
+			for (size_type i = 0; i < _size; ++i)
+				traits::destroy(_alloc, _data + i);
+	}
+
+	void release() {
+		destroy_items();
+		if (_data != nullptr)
+			traits::deallocate(_alloc, _data, _capacity);
+	}
+
+	Allocator _alloc;
+	T* _data { nullptr };
+	size_type _size { 0 };
+	size_type _capacity { 0 };
+};
+
+}
+}
+
+#endif /* DYNAMIC_ARRAY_H_ */
@@ -0,0 +1,211 @@
+#include <gtest/gtest.h>
+#include <ratio>
+#include <stdexcept>
+#include <string>
+#include "dynamic_array.h"
+#include "trees/avl_tree/avl_tree.h"
+
+using data_structures::arrays::dynamic_array;
+using data_structures::trees::avl_tree;
+
+namespace {
+
+/**< Counts copies and moves; moving may throw unless Nothrow */
+template<bool Nothrow>
+struct tracked {
+	tracked(int value = 0) :
+			value(value) {
+	}
+
+	tracked(const tracked& other) :
+			value(other.value) {
+		if (copies_left-- == 0)
+			throw std::runtime_error("Copy failed.");
+		++copies;
+	}
+
+	tracked(tracked&& other) noexcept(Nothrow) :
+			value(other.value) {
+		++moves;
+	}
+
+	tracked& operator=(const tracked& other) {
+		value = other.value;
+		++copies;
+		return *this;
+	}
+
+	tracked& operator=(tracked&& other) noexcept(Nothrow) {
+		value = other.value;
+		++moves;
+		return *this;
+	}
+
+	int value;
+	static int copies;
+	static int moves;
+	static int copies_left;
+};
+
+template<bool Nothrow>
+int tracked<Nothrow>::copies = 0;
+template<bool Nothrow>
+int tracked<Nothrow>::moves = 0;
+template<bool Nothrow>
+int tracked<Nothrow>::copies_left = -1;
+
+}
+
+class dynamic_array_test: public testing::Test {
+public:
+	dynamic_array<int> array;
+};
+
+TEST_F(dynamic_array_test, isCreatedEmpty) {
+	EXPECT_EQ(0, array.size());
+	EXPECT_EQ(0, array.capacity());
+	EXPECT_THROW(array.front(), std::out_of_range);
+	EXPECT_THROW(array.back(), std::out_of_range);
+}
+
+TEST_F(dynamic_array_test, pushBackPushesOnBack) {
+	for (int i = 0; i < 100; ++i)
+		array.push_back(i);
+	EXPECT_EQ(100, array.size());
+	for (int i = 0; i < 100; ++i)
+		EXPECT_EQ(i, array.at(i));
+	EXPECT_EQ(0, array.front());
+	EXPECT_EQ(99, array.back());
+}
+
+TEST_F(dynamic_array_test, pushShiftsTheTail) {
+	array = { 1, 2, 4 };
+	array.push(2, 3);
+	array.push_front(0);
+	array.push(5, 5);
+	EXPECT_TRUE(array == dynamic_array<int>({ 0, 1, 2, 3, 4, 5 }));
+	EXPECT_THROW(array.push(7, 42), std::out_of_range);
+}
+
+TEST_F(dynamic_array_test, pushOfOwnItemSurvivesReallocation) {
+	dynamic_array<std::string> strings { "first" };
+	strings.shrink_to_fit();
+	strings.push_back(strings[0]);
+	strings.push(0, strings[1]);
+	EXPECT_EQ(3, strings.size());
+	for (const auto& item : strings)
+		EXPECT_EQ("first", item);
+}
+
+TEST_F(dynamic_array_test, popClosesTheGap) {
+	array = { 0, 1, 2, 3, 4 };
+	EXPECT_EQ(2, array.pop(2));
+	EXPECT_EQ(0, array.pop_front());
+	EXPECT_EQ(4, array.pop_back());
+	EXPECT_TRUE(array == dynamic_array<int>({ 1, 3 }));
+	EXPECT_THROW(array.pop(2), std::out_of_range);
+	array.pop_back();
+	array.pop_back();
+	EXPECT_THROW(array.pop_back(), std::out_of_range);
+	EXPECT_THROW(array.pop_front(), std::out_of_range);
+}
+
+TEST_F(dynamic_array_test, atOutOfRangeThrows) {
+	EXPECT_THROW(array.at(0), std::out_of_range);
+	array.push_back(42);
+	EXPECT_THROW(array.at(1), std::out_of_range);
+}
+
+TEST_F(dynamic_array_test, reserveKeepsStorageStable) {
+	array.reserve(1000);
+	EXPECT_EQ(1000, array.capacity());
+	const int* storage = array.data();
+	for (int i = 0; i < 1000; ++i)
+		array.push_back(i);
+	EXPECT_EQ(storage, array.data());
+
+	array.reserve(10);
+	EXPECT_EQ(1000, array.capacity());
+}
+
+TEST_F(dynamic_array_test, shrinkToFitReleasesSpareCapacity) {
+	for (int i = 0; i < 100; ++i)
+		array.push_back(i);
+	array.shrink_to_fit();
+	EXPECT_EQ(100, array.capacity());
+	EXPECT_EQ(99, array.back());
+
+	array.clear();
+	EXPECT_EQ(100, array.capacity());
+	array.shrink_to_fit();
+	EXPECT_EQ(0, array.capacity());
+	EXPECT_EQ(nullptr, array.data());
+}
+
+TEST_F(dynamic_array_test, growthFactorIsConfigurable) {
+	dynamic_array<int, std::allocator<int>, std::ratio<2>> doubling;
+	std::size_t expected = 1;
+	for (int i = 0; i < 1000; ++i) {
+		doubling.push_back(i);
+		if (doubling.size() > expected)
+			expected *= 2;
+		EXPECT_EQ(expected, doubling.capacity());
+	}
+
+	for (int i = 0; i < 1000; ++i)
+		array.push_back(i);
+	EXPECT_LT(array.capacity(), 1500);
+}
+
+TEST_F(dynamic_array_test, relocationMovesNothrowItems) {
+	using item = tracked<true>;
+	dynamic_array<item> items;
+	for (int i = 0; i < 100; ++i)
+		items.emplace_back(i);
+	EXPECT_EQ(0, item::copies);
+	EXPECT_LT(0, item::moves);
+}
+
+TEST_F(dynamic_array_test, failedRelocationLeavesItemsIntact) {
+	using item = tracked<false>;
+	dynamic_array<item> items;
+	items.reserve(4);
+	for (int i = 0; i < 4; ++i)
+		items.emplace_back(i);
+
+	// A throwing move would not be undoable, so relocation has to copy.
+	item::copies_left = 2;
+	EXPECT_THROW(items.emplace_back(4), std::runtime_error);
+	item::copies_left = -1;
+
+	EXPECT_EQ(4, items.size());
+	EXPECT_EQ(4, items.capacity());
+	for (int i = 0; i < 4; ++i)
+		EXPECT_EQ(i, items[i].value);
+}
+
+TEST_F(dynamic_array_test, copyAndMove) {
+	array = { 1, 2, 3 };
+	dynamic_array<int> copy(array);
+	EXPECT_TRUE(copy == array);
+	copy.push_back(4);
+	EXPECT_TRUE(copy != array);
+
+	const int* storage = copy.data();
+	dynamic_array<int> moved(std::move(copy));
+	EXPECT_EQ(storage, moved.data());
+	EXPECT_EQ(0, copy.size());
+
+	array = moved;
+	EXPECT_TRUE(array == dynamic_array<int>({ 1, 2, 3, 4 }));
+}
+
+TEST_F(dynamic_array_test, servesAsTreeContainer) {
+	avl_tree<int, dynamic_array> tree;
+	for (int key : { 5, 3, 8, 1, 4 })
+		tree.insert(key);
+
+	dynamic_array<int> in_order = tree.in_order();
+	EXPECT_TRUE(in_order == dynamic_array<int>({ 1, 3, 4, 5, 8 }));
+	EXPECT_EQ(4, in_order.at(2));
+}
@@ -0,0 +1,99 @@
+#include "abstract/list.h"
+#include "abstract/tree.h"
+#include "arrays/circular_deque/circular_deque.h"
+#include "arrays/dynamic_array/dynamic_array.h"
+#include "benchmarks/linked/list_bench.h"
+#include "benchmarks/trees/tree_bench.h"
+#include "linked/doubly_linked_list/doubly_linked_list.h"
+#include "trees/avl_tree/avl_tree.h"
+
+using data_structures::abstract::list;
+using data_structures::abstract::tree;
+using data_structures::abstract::virtual_list;
+using data_structures::abstract::virtual_tree;
+using data_structures::arrays::circular_deque;
+using data_structures::arrays::dynamic_array;
+using data_structures::linked::doubly_linked_list;
+using data_structures::trees::avl_tree;
+
+namespace benchmarks {
+
+/**
+ * The same loops over a container, once through its own type and once
+ * through the virtual interface. Interface is what the loop sees; the
+ * pointer is laundered so the compiler cannot devirtualize the calls.
+ */
+template<typename Interface, typename Container>
+Interface* opaque(Container& container) {
+	Interface* view = &container;
+	benchmark::DoNotOptimize(view);
+	return view;
+}
+
+/**< Reads every position of a list of n items through at() */
+template<typename List, typename Interface>
+void at_all(benchmark::State& state) {
+	const auto n = state.range(0);
+	List list = filled<List>(n);
+	const Interface& view = *opaque<Interface>(list);
+	for (auto _ : state) {
+		long sum = 0;
+		for (auto i = 0; i < n; ++i)
+			sum += view.at(i);
+		benchmark::DoNotOptimize(sum);
+	}
+	state.SetItemsProcessed(state.iterations() * n);
+}
+
+/**< Batches of n pushes into a list cleared between batches */
+template<typename List, typename Interface>
+void push_back_all(benchmark::State& state) {
+	const auto n = state.range(0);
+	List list;
+	Interface& view = *opaque<Interface>(list);
+	for (auto _ : state) {
+		for (auto i = 0; i < n; ++i)
+			view.push_back(i);
+		for (auto i = 0; i < n; ++i)
+			benchmark::DoNotOptimize(view.pop_back());
+	}
+	state.SetItemsProcessed(state.iterations() * n);
+}
+
+/**< Successful lookups in random order on a tree of n keys */
+template<typename Tree, typename Interface>
+void has_all(benchmark::State& state) {
+	const auto keys = shuffled_keys(state.range(0));
+	Tree tree;
+	fill(tree, keys);
+	const Interface& view = *opaque<Interface>(tree);
+
+	std::size_t i = 0;
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(view.has(keys[i]));
+		if (++i == keys.size())
+			i = 0;
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+
+using erased_array = virtual_list<dynamic_array<int>>;
+using erased_deque = virtual_list<circular_deque<int>>;
+using erased_linked = virtual_list<doubly_linked_list<int>>;
+using erased_avl = virtual_tree<avl_tree<int>, doubly_linked_list>;
+using avl_interface = tree<int, doubly_linked_list>;
+
+BENCHMARK_TEMPLATE(at_all, dynamic_array<int>, dynamic_array<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(at_all, erased_array, list<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(at_all, circular_deque<int>, circular_deque<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(at_all, erased_deque, list<int>)->Apply(sizes);
+
+BENCHMARK_TEMPLATE(push_back_all, dynamic_array<int>, dynamic_array<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(push_back_all, erased_array, list<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(push_back_all, doubly_linked_list<int>, doubly_linked_list<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(push_back_all, erased_linked, list<int>)->Apply(sizes);
+
+BENCHMARK_TEMPLATE(has_all, avl_tree<int>, avl_tree<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(has_all, erased_avl, avl_interface)->Apply(sizes);
+
+}
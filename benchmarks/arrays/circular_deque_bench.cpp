@@ -0,0 +1,45 @@
+#include <deque>
+#include "arrays/circular_deque/circular_deque.h"
+#include "benchmarks/linked/list_bench.h"
+#include "linked/doubly_linked_list/doubly_linked_list.h"
+
+using data_structures::arrays::circular_deque;
+using data_structures::linked::doubly_linked_list;
+
+namespace benchmarks {
+
+/**< The fixed deque holds its 1024 slots inline, so it only runs up to 1e3 */
+using fixed_deque = circular_deque<int, 1024>;
+
+BENCHMARK_TEMPLATE(push_back, circular_deque<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(push_back, doubly_linked_list<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(push_back, std::deque<int>)->Apply(sizes);
+
+BENCHMARK_TEMPLATE(push_front, circular_deque<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(push_front, std::deque<int>)->Apply(sizes);
+
+BENCHMARK_TEMPLATE(pop_front, circular_deque<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(pop_front, std::deque<int>)->Apply(sizes);
+
+BENCHMARK_TEMPLATE(pop_back, circular_deque<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(pop_back, std::deque<int>)->Apply(sizes);
+
+BENCHMARK_TEMPLATE(fifo_steady, circular_deque<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(fifo_steady, fixed_deque)->Arg(100)->Arg(1000);
+BENCHMARK_TEMPLATE(fifo_steady, doubly_linked_list<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(fifo_steady, std::deque<int>)->Apply(sizes);
+
+BENCHMARK_TEMPLATE(pop_back_steady, circular_deque<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(pop_back_steady, fixed_deque)->Arg(100)->Arg(1000);
+BENCHMARK_TEMPLATE(pop_back_steady, doubly_linked_list<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(pop_back_steady, std::deque<int>)->Apply(sizes);
+
+BENCHMARK_TEMPLATE(at_middle, circular_deque<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(at_middle, std::deque<int>)->Apply(sizes);
+
+BENCHMARK_TEMPLATE(push_pop_middle, circular_deque<int>)->Apply(sizes);
+
+BENCHMARK_TEMPLATE(traverse, circular_deque<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(traverse, std::deque<int>)->Apply(sizes);
+
+}
@@ -0,0 +1,58 @@
+#include <ratio>
+#include <string>
+#include <vector>
+#include "arrays/dynamic_array/dynamic_array.h"
+#include "benchmarks/linked/list_bench.h"
+#include "benchmarks/trees/tree_bench.h"
+#include "linked/doubly_linked_list/doubly_linked_list.h"
+#include "trees/avl_tree/avl_tree.h"
+
+using data_structures::arrays::dynamic_array;
+using data_structures::linked::doubly_linked_list;
+using data_structures::trees::avl_tree;
+
+namespace benchmarks {
+
+/**
+ * Same workloads as the linked lists, against std::vector. Front pushes and
+ * pops shift the whole array, so those only run at the middle, one at a time.
+ */
+using doubling_array = dynamic_array<int, std::allocator<int>, std::ratio<2>>;
+
+BENCHMARK_TEMPLATE(push_back, dynamic_array<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(push_back, doubling_array)->Apply(sizes);
+BENCHMARK_TEMPLATE(push_back, std::vector<int>)->Apply(sizes);
+
+BENCHMARK_TEMPLATE(push_back_copy, dynamic_array<std::string>)->Apply(string_sizes);
+BENCHMARK_TEMPLATE(push_back_copy, std::vector<std::string>)->Apply(string_sizes);
+BENCHMARK_TEMPLATE(push_back_move, dynamic_array<std::string>)->Apply(string_sizes);
+BENCHMARK_TEMPLATE(push_back_move, std::vector<std::string>)->Apply(string_sizes);
+BENCHMARK_TEMPLATE(emplace_back, dynamic_array<std::string>)->Apply(string_sizes);
+BENCHMARK_TEMPLATE(emplace_back, std::vector<std::string>)->Apply(string_sizes);
+
+BENCHMARK_TEMPLATE(pop_back, dynamic_array<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(pop_back, std::vector<int>)->Apply(sizes);
+
+BENCHMARK_TEMPLATE(at_middle, dynamic_array<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(at_middle, std::vector<int>)->Apply(sizes);
+
+BENCHMARK_TEMPLATE(push_pop_middle, dynamic_array<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(push_pop_middle, std::vector<int>)->Apply(sizes);
+
+BENCHMARK_TEMPLATE(traverse, dynamic_array<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(traverse, std::vector<int>)->Apply(sizes);
+
+/**< Collecting a tree's keys into either container */
+template<typename Tree>
+void collect_in_order(benchmark::State& state) {
+	Tree tree;
+	fill(tree, shuffled_keys(state.range(0)));
+	for (auto _ : state)
+		benchmark::DoNotOptimize(tree.in_order());
+	state.SetItemsProcessed(state.iterations() * tree.size());
+}
+
+BENCHMARK_TEMPLATE(collect_in_order, avl_tree<int, dynamic_array>)->Apply(sizes);
+BENCHMARK_TEMPLATE(collect_in_order, avl_tree<int, doubly_linked_list>)->Apply(sizes);
+
+}
@@ -0,0 +1,257 @@
+#ifndef BENCH_H_
+#define BENCH_H_
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <cstddef>
+#include <deque>
+#include <forward_list>
+#include <iterator>
+#include <list>
+#include <numeric>
+#include <random>
+#include <set>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+namespace benchmarks {
+
+/**< Element counts every structure is measured at, 1e2 up to 1e7 */
+inline void sizes(benchmark::internal::Benchmark* bench) {
+	bench->RangeMultiplier(10)->Range(100, 10000000);
+}
+
+/**< Sizes for structures built to outgrow the caches, 1e6 up to 1e8 */
+inline void large_sizes(benchmark::internal::Benchmark* bench) {
+	bench->RangeMultiplier(10)->Range(1000000, 100000000);
+}
+
+/**< Batch sizes for payloads that own heap memory, 1e2 up to 1e5 */
+inline void string_sizes(benchmark::internal::Benchmark* bench) {
+	bench->RangeMultiplier(10)->Range(100, 100000);
+}
+
+/**< Thread counts doubling up to the hardware threads, timed on the wall clock */
+inline void thread_counts(benchmark::internal::Benchmark* bench) {
+	int threads = std::thread::hardware_concurrency();
+	bench->ThreadRange(1, threads > 0 ? threads : 1)->UseRealTime();
+}
+
+/**< Keys 0..n-1 in a reproducible random order */
+inline std::vector<int> shuffled_keys(std::size_t n) {
+	std::vector<int> keys(n);
+	std::iota(keys.begin(), keys.end(), 0);
+	std::shuffle(keys.begin(), keys.end(), std::mt19937(42));
+	return keys;
+}
+
+/**
+ * length draws of keys 0..keys-1 following Zipf's law: key k comes up in
+ * proportion to 1 / (k + 1)^skew, as in cache and index access traces.
+ */
+inline std::vector<int> zipf_trace(std::size_t keys, std::size_t length, double skew = 0.99) {
+	std::vector<double> weights(keys);
+	for (std::size_t k = 0; k < keys; ++k)
+		weights[k] = 1 / std::pow(k + 1.0, skew);
+	std::discrete_distribution<int> draw(weights.begin(), weights.end());
+
+	std::mt19937 random(42);
+	std::vector<int> trace(length);
+	for (auto& key : trace)
+		key = draw(random);
+	return trace;
+}
+
+/**< n distinct strings, each too long for the small string buffer */
+inline std::vector<std::string> long_strings(std::size_t n) {
+	std::vector<std::string> strings;
+	strings.reserve(n);
+	for (std::size_t i = 0; i < n; ++i)
+		strings.push_back(std::string(48, 'x') + std::to_string(i));
+	return strings;
+}
+
+/**
+ * The standard containers spell some operations differently; these
+ * overloads give every contender the interface of our structures.
+ */
+namespace ops {
+
+template<typename List>
+void append(List& list, int item) {
+	list.push_back(item);
+}
+
+template<typename T>
+void append(std::forward_list<T>& list, int item) {
+	list.push_front(item);
+}
+
+template<typename List>
+int pop_front(List& list) {
+	return list.pop_front();
+}
+
+template<typename T>
+T pop_front(std::list<T>& list) {
+	T item = list.front();
+	list.pop_front();
+	return item;
+}
+
+template<typename T>
+T pop_front(std::deque<T>& list) {
+	T item = list.front();
+	list.pop_front();
+	return item;
+}
+
+template<typename T>
+T pop_front(std::forward_list<T>& list) {
+	T item = list.front();
+	list.pop_front();
+	return item;
+}
+
+template<typename List>
+int pop_back(List& list) {
+	return list.pop_back();
+}
+
+template<typename T>
+T pop_back(std::list<T>& list) {
+	T item = list.back();
+	list.pop_back();
+	return item;
+}
+
+template<typename T>
+T pop_back(std::deque<T>& list) {
+	T item = list.back();
+	list.pop_back();
+	return item;
+}
+
+template<typename T>
+T pop_back(std::vector<T>& list) {
+	T item = list.back();
+	list.pop_back();
+	return item;
+}
+
+template<typename List>
+int at(const List& list, std::size_t position) {
+	return list.at(position);
+}
+
+template<typename T>
+T at(const std::list<T>& list, std::size_t position) {
+	return *std::next(list.begin(), position);
+}
+
+template<typename T>
+T at(const std::forward_list<T>& list, std::size_t position) {
+	return *std::next(list.begin(), position);
+}
+
+template<typename List>
+void push(List& list, std::size_t position, int item) {
+	list.push(position, item);
+}
+
+template<typename T>
+void push(std::list<T>& list, std::size_t position, int item) {
+	list.insert(std::next(list.begin(), position), item);
+}
+
+template<typename T>
+void push(std::vector<T>& list, std::size_t position, int item) {
+	list.insert(list.begin() + position, item);
+}
+
+template<typename T>
+void push(std::forward_list<T>& list, std::size_t position, int item) {
+	if (position == 0)
+		list.push_front(item);
+	else
+		list.insert_after(std::next(list.begin(), position - 1), item);
+}
+
+template<typename List>
+int pop(List& list, std::size_t position) {
+	return list.pop(position);
+}
+
+template<typename T>
+T pop(std::list<T>& list, std::size_t position) {
+	auto it = std::next(list.begin(), position);
+	T item = *it;
+	list.erase(it);
+	return item;
+}
+
+template<typename T>
+T pop(std::vector<T>& list, std::size_t position) {
+	T item = list[position];
+	list.erase(list.begin() + position);
+	return item;
+}
+
+template<typename T>
+T pop(std::forward_list<T>& list, std::size_t position) {
+	if (position == 0)
+		return pop_front(list);
+	auto before = std::next(list.begin(), position - 1);
+	T item = *std::next(before);
+	list.erase_after(before);
+	return item;
+}
+
+template<typename List, typename Iterator>
+void move_to_front(List& list, Iterator position) {
+	list.move_to_front(position);
+}
+
+template<typename T>
+void move_to_front(std::list<T>& list, typename std::list<T>::iterator position) {
+	list.splice(list.begin(), list, position);
+}
+
+template<typename Tree>
+bool has(const Tree& tree, int key) {
+	return tree.has(key);
+}
+
+template<typename T>
+bool has(const std::set<T>& tree, int key) {
+	return tree.find(key) != tree.end();
+}
+
+template<typename Tree>
+void remove(Tree& tree, int key) {
+	tree.remove(key);
+}
+
+template<typename T>
+void remove(std::set<T>& tree, int key) {
+	tree.erase(key);
+}
+
+template<typename T>
+bool has(const std::unordered_set<T>& set, int key) {
+	return set.find(key) != set.end();
+}
+
+template<typename T>
+void remove(std::unordered_set<T>& set, int key) {
+	set.erase(key);
+}
+
+}
+
+}
+
+#endif /* BENCH_H_ */
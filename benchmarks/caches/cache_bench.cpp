@@ -0,0 +1,77 @@
+#include <list>
+#include <unordered_map>
+#include <utility>
+#include "benchmarks/bench.h"
+#include "caches/lfu_cache/lfu_cache.h"
+#include "caches/lru_cache/lru_cache.h"
+
+using data_structures::caches::lfu_cache;
+using data_structures::caches::lru_cache;
+
+namespace benchmarks {
+
+/**< The usual hand-rolled LRU over std::list and std::unordered_map, as a reference */
+class std_lru {
+public:
+	explicit std_lru(std::size_t capacity) :
+			_capacity(capacity) {
+	}
+
+	const int* get(int key) {
+		auto found = _index.find(key);
+		if (found == _index.end())
+			return nullptr;
+		_entries.splice(_entries.begin(), _entries, found->second);
+		return &found->second->second;
+	}
+
+	void put(int key, int value) {
+		auto found = _index.find(key);
+		if (found != _index.end()) {
+			found->second->second = value;
+			_entries.splice(_entries.begin(), _entries, found->second);
+			return;
+		}
+		_entries.emplace_front(key, value);
+		_index.emplace(key, _entries.begin());
+		if (_entries.size() > _capacity) {
+			_index.erase(_entries.back().first);
+			_entries.pop_back();
+		}
+	}
+
+private:
+	std::size_t _capacity;
+	std::list<std::pair<int, int>> _entries;
+	std::unordered_map<int, std::list<std::pair<int, int>>::iterator> _index;
+};
+
+/**
+ * Read-through over a Zipfian trace of 2^20 requests on n keys, the cache
+ * holding a tenth of them: each miss puts the key. Reports the hit ratio.
+ */
+template<typename Cache>
+void zipf_read_through(benchmark::State& state) {
+	const auto keys = state.range(0);
+	const auto trace = zipf_trace(keys, 1 << 20);
+	Cache cache(keys / 10);
+
+	std::size_t hits = 0, requests = 0;
+	for (auto _ : state) {
+		for (auto key : trace) {
+			if (cache.get(key) != nullptr)
+				++hits;
+			else
+				cache.put(key, key);
+		}
+		requests += trace.size();
+	}
+	state.SetItemsProcessed(requests);
+	state.counters["hit_ratio"] = static_cast<double>(hits) / requests;
+}
+
+BENCHMARK_TEMPLATE(zipf_read_through, lru_cache<int, int>)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(zipf_read_through, lfu_cache<int, int>)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(zipf_read_through, std_lru)->RangeMultiplier(10)->Range(1000, 1000000);
+
+}
@@ -0,0 +1,150 @@
+#include <map>
+#include <vector>
+#include "benchmarks/bench.h"
+#include "graphs/csr_graph/csr_graph.h"
+#include "linked/doubly_linked_list/doubly_linked_list.h"
+
+using data_structures::graphs::csr_graph;
+using data_structures::linked::doubly_linked_list;
+
+namespace benchmarks {
+
+using graph = csr_graph<>;
+using vertex = graph::vertex;
+
+/**< Edge counts from 1e5 up to 1e7, on 16 edges per vertex */
+inline void edge_counts(benchmark::internal::Benchmark* bench) {
+	bench->RangeMultiplier(10)->Range(100000, 10000000)->Unit(benchmark::kMillisecond);
+}
+
+/**
+ * Power-law graph after Chakrabarti et al., "R-MAT: A Recursive Model for
+ * Graph Mining", with the Graph500 parameters: each edge falls in a
+ * quadrant of the adjacency matrix with probabilities a, b, c and d, then
+ * recursively within it. Generated once per size, on the next power of two
+ * above edges / 16 vertices, with weights up to 255.
+ */
+inline const std::vector<graph::edge>& rmat_edges(std::size_t edges) {
+	static std::map<std::size_t, std::vector<graph::edge>> cache;
+	auto& result = cache[edges];
+	if (!result.empty())
+		return result;
+
+	const double a = 0.57, b = 0.19, c = 0.19;
+	unsigned scale = 0;
+	while ((std::size_t(1) << scale) < edges / 16)
+		++scale;
+	std::mt19937 random(42);
+	std::uniform_real_distribution<double> quadrant(0, 1);
+	result.reserve(edges);
+	for (std::size_t i = 0; i < edges; ++i) {
+		vertex from = 0, to = 0;
+		for (unsigned bit = 0; bit < scale; ++bit) {
+			const double p = quadrant(random);
+			const bool lower = p >= a + b;
+			const bool right = (p >= a && p < a + b) || p >= a + b + c;
+			from = from << 1 | lower;
+			to = to << 1 | right;
+		}
+		result.emplace_back(from, to, random() & 0xFF);
+	}
+	return result;
+}
+
+inline std::size_t rmat_vertices(std::size_t edges) {
+	std::size_t vertices = 1;
+	while (vertices < edges / 16)
+		vertices <<= 1;
+	return vertices;
+}
+
+/**< Compressed sparse row build from the edge list, a counting sort */
+void build_csr(benchmark::State& state) {
+	const auto& edges = rmat_edges(state.range(0));
+	for (auto _ : state) {
+		graph g(rmat_vertices(edges.size()), edges);
+		benchmark::DoNotOptimize(g);
+	}
+	state.SetItemsProcessed(state.iterations() * edges.size());
+}
+
+/**< The same build into one doubly_linked_list of targets per vertex */
+void build_lists(benchmark::State& state) {
+	const auto& edges = rmat_edges(state.range(0));
+	for (auto _ : state) {
+		std::vector<doubly_linked_list<vertex>> adjacency(rmat_vertices(edges.size()));
+		for (const auto& e : edges)
+			adjacency[e._from].push_back(e._to);
+		benchmark::DoNotOptimize(adjacency);
+	}
+	state.SetItemsProcessed(state.iterations() * edges.size());
+}
+
+/**< BFS from vertex 0, the biggest hub; items are the edges of the graph */
+void bfs_csr(benchmark::State& state) {
+	const auto& edges = rmat_edges(state.range(0));
+	graph g(rmat_vertices(edges.size()), edges);
+	for (auto _ : state)
+		benchmark::DoNotOptimize(g.bfs(0));
+	state.SetItemsProcessed(state.iterations() * edges.size());
+}
+
+void bfs_lists(benchmark::State& state) {
+	const auto& edges = rmat_edges(state.range(0));
+	std::vector<doubly_linked_list<vertex>> adjacency(rmat_vertices(edges.size()));
+	for (const auto& e : edges)
+		adjacency[e._from].push_back(e._to);
+
+	for (auto _ : state) {
+		std::vector<std::size_t> distance(adjacency.size(), graph::unreachable);
+		std::vector<vertex> queue(1, 0);
+		distance[0] = 0;
+		for (std::size_t head = 0; head < queue.size(); ++head) {
+			const vertex v = queue[head];
+			for (auto u : adjacency[v]) {
+				if (distance[u] == graph::unreachable) {
+					distance[u] = distance[v] + 1;
+					queue.push_back(u);
+				}
+			}
+		}
+		benchmark::DoNotOptimize(distance);
+	}
+	state.SetItemsProcessed(state.iterations() * edges.size());
+}
+
+/**< Direction-optimizing BFS on state.range(1) threads */
+void parallel_bfs_csr(benchmark::State& state) {
+	const auto& edges = rmat_edges(state.range(0));
+	graph g(rmat_vertices(edges.size()), edges);
+	for (auto _ : state)
+		benchmark::DoNotOptimize(g.parallel_bfs(0, state.range(1)));
+	state.SetItemsProcessed(state.iterations() * edges.size());
+}
+
+void parallel_bfs_threads(benchmark::internal::Benchmark* bench) {
+	int threads = std::thread::hardware_concurrency();
+	for (long edges = 100000; edges <= 10000000; edges *= 10)
+		for (int t = 1; t <= std::max(threads, 1); t *= 2)
+			bench->Args({ edges, t });
+	bench->Unit(benchmark::kMillisecond)->UseRealTime();
+}
+
+void dijkstra_csr(benchmark::State& state) {
+	const auto& edges = rmat_edges(state.range(0));
+	graph g(rmat_vertices(edges.size()), edges);
+	for (auto _ : state)
+		benchmark::DoNotOptimize(g.dijkstra(0));
+	state.SetItemsProcessed(state.iterations() * edges.size());
+}
+
+BENCHMARK(build_csr)->Apply(edge_counts);
+BENCHMARK(build_lists)->Apply(edge_counts);
+
+BENCHMARK(bfs_csr)->Apply(edge_counts);
+BENCHMARK(bfs_lists)->Apply(edge_counts);
+BENCHMARK(parallel_bfs_csr)->Apply(parallel_bfs_threads);
+
+BENCHMARK(dijkstra_csr)->Apply(edge_counts);
+
+}
@@ -0,0 +1,63 @@
+#include <unordered_map>
+#include <unordered_set>
+#include "benchmarks/trees/tree_bench.h"
+#include "hashing/flat_hash_map/flat_hash_map.h"
+#include "hashing/flat_hash_set/flat_hash_set.h"
+#include "trees/avl_tree/avl_tree.h"
+
+using data_structures::hashing::flat_hash_map;
+using data_structures::hashing::flat_hash_set;
+using data_structures::trees::avl_tree;
+
+namespace benchmarks {
+
+/**< Failed lookups in random order on a container of n keys; the tree still walks down to a leaf */
+template<typename Set>
+void has_missing(benchmark::State& state) {
+	const auto keys = shuffled_keys(state.range(0));
+	Set set;
+	fill(set, keys);
+
+	const int offset = keys.size();
+	std::size_t i = 0;
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(ops::has(set, keys[i] + offset));
+		if (++i == keys.size())
+			i = 0;
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+
+/**< Counting a skewed trace of n distinct keys, where most increments hit a present key */
+template<typename Map>
+void count_trace(benchmark::State& state) {
+	const auto trace = zipf_trace(state.range(0), 4 * state.range(0));
+	for (auto _ : state) {
+		Map counts;
+		for (auto key : trace)
+			++counts[key];
+		benchmark::DoNotOptimize(counts);
+	}
+	state.SetItemsProcessed(state.iterations() * trace.size());
+}
+
+BENCHMARK_TEMPLATE(insert, flat_hash_set<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(insert, std::unordered_set<int>)->Apply(sizes);
+
+BENCHMARK_TEMPLATE(has, flat_hash_set<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(has, std::unordered_set<int>)->Apply(sizes);
+
+BENCHMARK_TEMPLATE(has_missing, flat_hash_set<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(has_missing, std::unordered_set<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(has_missing, avl_tree<int>)->Apply(sizes);
+
+BENCHMARK_TEMPLATE(remove, flat_hash_set<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(remove, std::unordered_set<int>)->Apply(sizes);
+
+BENCHMARK_TEMPLATE(iterate, flat_hash_set<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(iterate, std::unordered_set<int>)->Apply(sizes);
+
+BENCHMARK_TEMPLATE(count_trace, flat_hash_map<int, int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(count_trace, std::unordered_map<int, int>)->Apply(sizes);
+
+}
@@ -0,0 +1,216 @@
+#include <functional>
+#include <queue>
+#include <vector>
+#include "benchmarks/bench.h"
+#include "heaps/d_ary_heap/d_ary_heap.h"
+#include "heaps/indexed_heap/indexed_heap.h"
+#include "heaps/pairing_heap/pairing_heap.h"
+#include "trees/avl_tree/avl_tree.h"
+
+using data_structures::heaps::d_ary_heap;
+using data_structures::heaps::indexed_heap;
+using data_structures::heaps::pairing_heap;
+using data_structures::trees::avl_tree;
+
+namespace benchmarks {
+
+using std_heap = std::priority_queue<int, std::vector<int>, std::greater<int>>;
+
+/**< Least item out of either kind of queue */
+template<typename Heap>
+int pop_least(Heap& heap) {
+	return heap.pop();
+}
+
+inline int pop_least(std_heap& heap) {
+	int item = heap.top();
+	heap.pop();
+	return item;
+}
+
+/**< How schedulers get by without a heap: the tree's first item in order */
+inline int pop_least(avl_tree<int>& tree) {
+	int item = tree.in_order().front();
+	tree.remove(item);
+	return item;
+}
+
+template<typename Heap>
+void meld(Heap& heap, Heap&& other) {
+	while (!other.empty())
+		heap.push(pop_least(other));
+}
+
+template<typename T>
+void meld(pairing_heap<T>& heap, pairing_heap<T>&& other) {
+	heap.meld(std::move(other));
+}
+
+template<typename Heap>
+void push_item(Heap& heap, int item) {
+	heap.push(item);
+}
+
+inline void push_item(avl_tree<int>& tree, int item) {
+	tree.insert(item);
+}
+
+/**< n pushes in random order, then n pops, as a heap sort */
+template<typename Heap>
+void push_pop_all(benchmark::State& state) {
+	const auto keys = shuffled_keys(state.range(0));
+	for (auto _ : state) {
+		Heap heap;
+		for (auto key : keys)
+			push_item(heap, key);
+		for (std::size_t i = 0; i < keys.size(); ++i)
+			benchmark::DoNotOptimize(pop_least(heap));
+	}
+	state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+/**
+ * The hold model of event queues: on a queue of n items, pop the least and
+ * push it back somewhat later, as a timer wheel reschedules.
+ */
+template<typename Heap>
+void hold(benchmark::State& state) {
+	const auto keys = shuffled_keys(state.range(0));
+	Heap heap;
+	for (auto key : keys)
+		push_item(heap, key);
+
+	std::mt19937 random(42);
+	for (auto _ : state)
+		push_item(heap, pop_least(heap) + random() % keys.size());
+	state.SetItemsProcessed(state.iterations());
+}
+
+/**
+ * Dijkstra's access pattern on n keys: every pop is followed by a few
+ * decreases of queued keys. Lazy queues push a duplicate instead and skip
+ * the outdated entries when they surface.
+ */
+void decrease_key_indexed(benchmark::State& state) {
+	const std::size_t n = state.range(0);
+	std::mt19937 random(42);
+	for (auto _ : state) {
+		indexed_heap<unsigned> heap;
+		heap.reserve(n);
+		for (std::size_t key = 0; key < n; ++key)
+			heap.push(key, 1000000 + random() % 1000000);
+		while (!heap.empty()) {
+			const unsigned base = heap.top_priority();
+			heap.pop();
+			for (int i = 0; i < 4; ++i) {
+				std::size_t key = random() % n;
+				if (heap.has(key) && base + i < heap.priority(key))
+					heap.decrease_key(key, base + i);
+			}
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * n);
+}
+
+void decrease_key_pairing(benchmark::State& state) {
+	const std::size_t n = state.range(0);
+	std::mt19937 random(42);
+	for (auto _ : state) {
+		using entry = std::pair<unsigned, std::size_t>;
+		pairing_heap<entry> heap;
+		std::vector<pairing_heap<entry>::handle> handles(n);
+		std::vector<bool> done(n);
+		for (std::size_t key = 0; key < n; ++key)
+			handles[key] = heap.push(entry(1000000 + random() % 1000000, key));
+		while (!heap.empty()) {
+			entry top = heap.pop();
+			done[top.second] = true;
+			for (unsigned i = 0; i < 4; ++i) {
+				std::size_t key = random() % n;
+				if (!done[key] && top.first + i < handles[key]->first)
+					heap.decrease_key(handles[key], entry(top.first + i, key));
+			}
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * n);
+}
+
+void decrease_key_lazy(benchmark::State& state) {
+	const std::size_t n = state.range(0);
+	std::mt19937 random(42);
+	for (auto _ : state) {
+		using entry = std::pair<unsigned, std::size_t>;
+		std::priority_queue<entry, std::vector<entry>, std::greater<entry>> heap;
+		std::vector<unsigned> priorities(n);
+		std::vector<bool> done(n);
+		for (std::size_t key = 0; key < n; ++key) {
+			priorities[key] = 1000000 + random() % 1000000;
+			heap.emplace(priorities[key], key);
+		}
+		while (!heap.empty()) {
+			entry top = heap.top();
+			heap.pop();
+			if (done[top.second] || top.first != priorities[top.second])
+				continue;
+			done[top.second] = true;
+			for (unsigned i = 0; i < 4; ++i) {
+				std::size_t key = random() % n;
+				if (!done[key] && top.first + i < priorities[key]) {
+					priorities[key] = top.first + i;
+					heap.emplace(priorities[key], key);
+				}
+			}
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * n);
+}
+
+/**
+ * Meld-heavy work, as when merging per-worker queues: n items arrive in
+ * queues of 64, each folded into the main queue, which then drains. The
+ * array heaps have to push the items of each small queue one by one.
+ */
+template<typename Heap>
+void merge_queues(benchmark::State& state) {
+	const auto keys = shuffled_keys(state.range(0));
+	for (auto _ : state) {
+		Heap heap;
+		for (std::size_t first = 0; first < keys.size(); first += 64) {
+			Heap batch;
+			for (std::size_t i = first; i < std::min(first + 64, keys.size()); ++i)
+				batch.push(keys[i]);
+			meld(heap, std::move(batch));
+		}
+		for (std::size_t i = 0; i < keys.size(); ++i)
+			benchmark::DoNotOptimize(pop_least(heap));
+	}
+	state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+/**< Up to 1e4 items, since the in_order() fallback makes each pop O(n) */
+inline void small_sizes(benchmark::internal::Benchmark* bench) {
+	bench->RangeMultiplier(10)->Range(100, 10000);
+}
+
+BENCHMARK_TEMPLATE(push_pop_all, d_ary_heap<int, 2>)->Apply(sizes);
+BENCHMARK_TEMPLATE(push_pop_all, d_ary_heap<int, 4>)->Apply(sizes);
+BENCHMARK_TEMPLATE(push_pop_all, d_ary_heap<int, 8>)->Apply(sizes);
+BENCHMARK_TEMPLATE(push_pop_all, pairing_heap<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(push_pop_all, std_heap)->Apply(sizes);
+BENCHMARK_TEMPLATE(push_pop_all, avl_tree<int>)->Apply(small_sizes);
+
+BENCHMARK_TEMPLATE(hold, d_ary_heap<int, 2>)->Apply(sizes);
+BENCHMARK_TEMPLATE(hold, d_ary_heap<int, 4>)->Apply(sizes);
+BENCHMARK_TEMPLATE(hold, d_ary_heap<int, 8>)->Apply(sizes);
+BENCHMARK_TEMPLATE(hold, pairing_heap<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(hold, std_heap)->Apply(sizes);
+
+BENCHMARK(decrease_key_indexed)->Apply(sizes);
+BENCHMARK(decrease_key_pairing)->Apply(sizes);
+BENCHMARK(decrease_key_lazy)->Apply(sizes);
+
+BENCHMARK_TEMPLATE(merge_queues, pairing_heap<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(merge_queues, d_ary_heap<int, 4>)->Apply(sizes);
+BENCHMARK_TEMPLATE(merge_queues, std_heap)->Apply(sizes);
+
+}
@@ -0,0 +1,61 @@
+#include <mutex>
+#include "benchmarks/bench.h"
+#include "linked/concurrent_queue/concurrent_queue.h"
+#include "linked/doubly_linked_list/doubly_linked_list.h"
+
+using data_structures::linked::concurrent_queue;
+using data_structures::linked::doubly_linked_list;
+
+namespace benchmarks {
+
+/**< doubly_linked_list behind one global mutex, the usual way of sharing it */
+template<typename T>
+class locked_queue {
+public:
+	void push_back(const T& item) {
+		std::lock_guard<std::mutex> lock(_mutex);
+		_list.push_back(item);
+	}
+
+	bool try_pop_front(T& item) {
+		std::lock_guard<std::mutex> lock(_mutex);
+		if (_list.size() == 0)
+			return false;
+		item = _list.pop_front();
+		return true;
+	}
+
+private:
+	std::mutex _mutex;
+	doubly_linked_list<T> _list;
+};
+
+/**
+ * Every thread is both producer and consumer, pushing an item and popping
+ * one per iteration, on a queue that starts with n items so consumers
+ * rarely find it empty.
+ */
+template<typename Queue>
+void producer_consumer(benchmark::State& state) {
+	static Queue* queue;
+	if (state.thread_index() == 0) {
+		queue = new Queue;
+		for (int i = 0; i < state.range(0); ++i)
+			queue->push_back(i);
+	}
+
+	int item = state.thread_index();
+	for (auto _ : state) {
+		queue->push_back(item);
+		benchmark::DoNotOptimize(queue->try_pop_front(item));
+	}
+	state.SetItemsProcessed(state.iterations() * 2);
+
+	if (state.thread_index() == 0)
+		delete queue;
+}
+
+BENCHMARK_TEMPLATE(producer_consumer, concurrent_queue<int>)->Arg(1000)->Apply(thread_counts);
+BENCHMARK_TEMPLATE(producer_consumer, locked_queue<int>)->Arg(1000)->Apply(thread_counts);
+
+}
@@ -0,0 +1,87 @@
+#include <list>
+#include <string>
+#include <vector>
+#include "benchmarks/linked/list_bench.h"
+#include "linked/doubly_linked_list/doubly_linked_list.h"
+
+using data_structures::linked::doubly_linked_list;
+
+namespace benchmarks {
+
+BENCHMARK_TEMPLATE(push_front, doubly_linked_list<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(push_front, std::list<int>)->Apply(sizes);
+
+BENCHMARK_TEMPLATE(push_back, doubly_linked_list<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(push_back, std::list<int>)->Apply(sizes);
+
+BENCHMARK_TEMPLATE(push_back_copy, doubly_linked_list<std::string>)->Apply(string_sizes);
+BENCHMARK_TEMPLATE(push_back_copy, std::list<std::string>)->Apply(string_sizes);
+BENCHMARK_TEMPLATE(push_back_move, doubly_linked_list<std::string>)->Apply(string_sizes);
+BENCHMARK_TEMPLATE(push_back_move, std::list<std::string>)->Apply(string_sizes);
+BENCHMARK_TEMPLATE(emplace_back, doubly_linked_list<std::string>)->Apply(string_sizes);
+BENCHMARK_TEMPLATE(emplace_back, std::list<std::string>)->Apply(string_sizes);
+
+BENCHMARK_TEMPLATE(pop_front, doubly_linked_list<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(pop_front, std::list<int>)->Apply(sizes);
+
+BENCHMARK_TEMPLATE(pop_back, doubly_linked_list<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(pop_back, std::list<int>)->Apply(sizes);
+
+BENCHMARK_TEMPLATE(at_middle, doubly_linked_list<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(at_middle, std::list<int>)->Apply(sizes);
+
+BENCHMARK_TEMPLATE(push_pop_middle, doubly_linked_list<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(push_pop_middle, std::list<int>)->Apply(sizes);
+
+BENCHMARK_TEMPLATE(traverse, doubly_linked_list<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(traverse, std::list<int>)->Apply(sizes);
+
+template<typename List>
+void traverse_backwards(benchmark::State& state) {
+	const auto n = state.range(0);
+	List list = filled<List>(n);
+	for (auto _ : state) {
+		long sum = 0;
+		for (auto it = list.rbegin(); it != list.rend(); --it)
+			sum += *it;
+		benchmark::DoNotOptimize(sum);
+	}
+	state.SetItemsProcessed(state.iterations() * n);
+}
+
+BENCHMARK_TEMPLATE(traverse_backwards, doubly_linked_list<int>)->Apply(sizes);
+
+/**
+ * Touching a random entry of n, as an LRU cache does on every hit: the
+ * caller holds an iterator to each entry and moves it to the front.
+ */
+template<typename List>
+void lru_touch(benchmark::State& state) {
+	List list = filled<List>(state.range(0));
+	std::vector<typename List::iterator> entries;
+	for (auto it = list.begin(); it != list.end(); ++it)
+		entries.push_back(it);
+
+	std::mt19937 random(42);
+	for (auto _ : state)
+		ops::move_to_front(list, entries[random() % entries.size()]);
+	state.SetItemsProcessed(state.iterations());
+}
+
+/**< The same touch through positions, all that was available before iterators could mutate */
+template<typename List>
+void lru_touch_by_index(benchmark::State& state) {
+	const auto n = state.range(0);
+	List list = filled<List>(n);
+
+	std::mt19937 random(42);
+	for (auto _ : state)
+		list.push_front(list.pop(random() % n));
+	state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_TEMPLATE(lru_touch, doubly_linked_list<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(lru_touch, std::list<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(lru_touch_by_index, doubly_linked_list<int>)->RangeMultiplier(10)->Range(100, 100000);
+
+}
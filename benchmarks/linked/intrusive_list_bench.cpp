@@ -0,0 +1,133 @@
+#include <list>
+#include <vector>
+#include "benchmarks/bench.h"
+#include "linked/doubly_linked_list/doubly_linked_list.h"
+#include "linked/intrusive_doubly_linked_list/intrusive_doubly_linked_list.h"
+#include "linked/intrusive_singly_linked_list/intrusive_singly_linked_list.h"
+#include "linked/singly_linked_list/singly_linked_list.h"
+
+using data_structures::linked::doubly_linked_list;
+using data_structures::linked::forward_list_hook;
+using data_structures::linked::intrusive_doubly_linked_list;
+using data_structures::linked::intrusive_singly_linked_list;
+using data_structures::linked::list_hook;
+using data_structures::linked::singly_linked_list;
+
+namespace benchmarks {
+
+/**< An object that already lives elsewhere and gets queued, by hook or by pointer */
+struct job {
+	long payload;
+	list_hook<job> hook;
+	forward_list_hook<job> forward_hook;
+};
+
+using intrusive_doubly = intrusive_doubly_linked_list<job, &job::hook>;
+using intrusive_singly = intrusive_singly_linked_list<job, &job::forward_hook>;
+
+/**
+ * The owning lists hold job pointers, so every access goes through one more
+ * indirection and every push allocates a node. These overloads let both
+ * kinds be driven by the same code.
+ */
+inline void link(intrusive_doubly& list, job& item) {
+	list.push_back(item);
+}
+
+inline void link(intrusive_singly& list, job& item) {
+	list.push_back(item);
+}
+
+template<typename List>
+void link(List& list, job& item) {
+	list.push_back(&item);
+}
+
+inline job& unlink_front(intrusive_doubly& list) {
+	return list.pop_front();
+}
+
+inline job& unlink_front(intrusive_singly& list) {
+	return list.pop_front();
+}
+
+template<typename List>
+job& unlink_front(List& list) {
+	return *list.pop_front();
+}
+
+inline job& unlink_front(std::list<job*>& list) {
+	job* item = list.front();
+	list.pop_front();
+	return *item;
+}
+
+inline job& deref(job& item) {
+	return item;
+}
+
+inline job& deref(job* item) {
+	return *item;
+}
+
+/**< Queues n existing jobs and drains them again */
+template<typename List>
+void enqueue_drain(benchmark::State& state) {
+	std::vector<job> jobs(state.range(0));
+	List list;
+	for (auto _ : state) {
+		for (auto& item : jobs)
+			link(list, item);
+		for (std::size_t i = 0; i < jobs.size(); ++i)
+			benchmark::DoNotOptimize(unlink_front(list).payload);
+	}
+	state.SetItemsProcessed(state.iterations() * jobs.size());
+}
+
+/**< Reads the payload of each of n queued jobs */
+template<typename List>
+void traverse_jobs(benchmark::State& state) {
+	std::vector<job> jobs(state.range(0));
+	for (std::size_t i = 0; i < jobs.size(); ++i)
+		jobs[i].payload = i;
+	List list;
+	for (auto& item : jobs)
+		link(list, item);
+
+	for (auto _ : state) {
+		long sum = 0;
+		for (auto&& item : list)
+			sum += deref(item).payload;
+		benchmark::DoNotOptimize(sum);
+	}
+	state.SetItemsProcessed(state.iterations() * jobs.size());
+}
+
+/**< Unlinks one job from the middle of n and queues it again */
+void remove_middle_intrusive(benchmark::State& state) {
+	std::vector<job> jobs(state.range(0));
+	intrusive_doubly list;
+	for (auto& item : jobs)
+		link(list, item);
+
+	job& middle = jobs[jobs.size() / 2];
+	for (auto _ : state) {
+		list.remove(middle);
+		list.push_back(middle);
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_TEMPLATE(enqueue_drain, intrusive_doubly)->Apply(sizes);
+BENCHMARK_TEMPLATE(enqueue_drain, intrusive_singly)->Apply(sizes);
+BENCHMARK_TEMPLATE(enqueue_drain, doubly_linked_list<job*>)->Apply(sizes);
+BENCHMARK_TEMPLATE(enqueue_drain, singly_linked_list<job*>)->Apply(sizes);
+BENCHMARK_TEMPLATE(enqueue_drain, std::list<job*>)->Apply(sizes);
+
+BENCHMARK_TEMPLATE(traverse_jobs, intrusive_doubly)->Apply(sizes);
+BENCHMARK_TEMPLATE(traverse_jobs, doubly_linked_list<job*>)->Apply(sizes);
+BENCHMARK_TEMPLATE(traverse_jobs, std::list<job*>)->Apply(sizes);
+
+BENCHMARK(remove_middle_intrusive)->Apply(sizes);
+
+}
@@ -0,0 +1,163 @@
+#ifndef LIST_BENCH_H_
+#define LIST_BENCH_H_
+
+#include "benchmarks/bench.h"
+
+namespace benchmarks {
+
+/**< A list of n items, appended wherever the list appends cheaply */
+template<typename List>
+List filled(std::size_t n) {
+	List list;
+	for (std::size_t i = 0; i < n; ++i)
+		ops::append(list, static_cast<int>(i));
+	return list;
+}
+
+/**< Batches of n pushes into an empty list, teardown included */
+template<typename List>
+void push_front(benchmark::State& state) {
+	const auto n = state.range(0);
+	for (auto _ : state) {
+		List list;
+		for (auto i = 0; i < n; ++i)
+			list.push_front(i);
+		benchmark::DoNotOptimize(list);
+	}
+	state.SetItemsProcessed(state.iterations() * n);
+}
+
+template<typename List>
+void push_back(benchmark::State& state) {
+	const auto n = state.range(0);
+	for (auto _ : state) {
+		List list;
+		for (auto i = 0; i < n; ++i)
+			list.push_back(i);
+		benchmark::DoNotOptimize(list);
+	}
+	state.SetItemsProcessed(state.iterations() * n);
+}
+
+/**< Appending n long strings by copy, by move, and built in place */
+template<typename List>
+void push_back_copy(benchmark::State& state) {
+	const auto strings = long_strings(state.range(0));
+	for (auto _ : state) {
+		List list;
+		for (const auto& item : strings)
+			list.push_back(item);
+		benchmark::DoNotOptimize(list);
+	}
+	state.SetItemsProcessed(state.iterations() * strings.size());
+}
+
+template<typename List>
+void push_back_move(benchmark::State& state) {
+	const auto strings = long_strings(state.range(0));
+	for (auto _ : state) {
+		state.PauseTiming();
+		auto batch = strings;
+		state.ResumeTiming();
+		List list;
+		for (auto& item : batch)
+			list.push_back(std::move(item));
+		benchmark::DoNotOptimize(list);
+	}
+	state.SetItemsProcessed(state.iterations() * strings.size());
+}
+
+template<typename List>
+void emplace_back(benchmark::State& state) {
+	const auto n = state.range(0);
+	for (auto _ : state) {
+		List list;
+		for (auto i = 0; i < n; ++i)
+			list.emplace_back(48, 'x');
+		benchmark::DoNotOptimize(list);
+	}
+	state.SetItemsProcessed(state.iterations() * n);
+}
+
+/**< Batches of n pops, with the refill kept out of the measurement */
+template<typename List>
+void pop_front(benchmark::State& state) {
+	const auto n = state.range(0);
+	for (auto _ : state) {
+		state.PauseTiming();
+		List list = filled<List>(n);
+		state.ResumeTiming();
+		for (auto i = 0; i < n; ++i)
+			benchmark::DoNotOptimize(ops::pop_front(list));
+	}
+	state.SetItemsProcessed(state.iterations() * n);
+}
+
+template<typename List>
+void pop_back(benchmark::State& state) {
+	const auto n = state.range(0);
+	for (auto _ : state) {
+		state.PauseTiming();
+		List list = filled<List>(n);
+		state.ResumeTiming();
+		for (auto i = 0; i < n; ++i)
+			benchmark::DoNotOptimize(ops::pop_back(list));
+	}
+	state.SetItemsProcessed(state.iterations() * n);
+}
+
+/**< One pop_back() and the push_back() restoring it, on a list of n items */
+template<typename List>
+void pop_back_steady(benchmark::State& state) {
+	List list = filled<List>(state.range(0));
+	for (auto _ : state)
+		list.push_back(ops::pop_back(list));
+	state.SetItemsProcessed(state.iterations());
+}
+
+/**< One push_back() and one pop_front(), the steady state of a queue of n items */
+template<typename List>
+void fifo_steady(benchmark::State& state) {
+	List list = filled<List>(state.range(0));
+	for (auto _ : state)
+		list.push_back(ops::pop_front(list));
+	state.SetItemsProcessed(state.iterations());
+}
+
+template<typename List>
+void at_middle(benchmark::State& state) {
+	const auto n = state.range(0);
+	List list = filled<List>(n);
+	for (auto _ : state)
+		benchmark::DoNotOptimize(ops::at(list, n / 2));
+	state.SetItemsProcessed(state.iterations());
+}
+
+/**< One push(i) and the pop(i) undoing it, halfway through a list of n items */
+template<typename List>
+void push_pop_middle(benchmark::State& state) {
+	const auto n = state.range(0);
+	List list = filled<List>(n);
+	for (auto _ : state) {
+		ops::push(list, n / 2, 42);
+		benchmark::DoNotOptimize(ops::pop(list, n / 2));
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+
+template<typename List>
+void traverse(benchmark::State& state) {
+	const auto n = state.range(0);
+	List list = filled<List>(n);
+	for (auto _ : state) {
+		long sum = 0;
+		for (auto item : list)
+			sum += item;
+		benchmark::DoNotOptimize(sum);
+	}
+	state.SetItemsProcessed(state.iterations() * n);
+}
+
+}
+
+#endif /* LIST_BENCH_H_ */
@@ -0,0 +1,37 @@
+#include <forward_list>
+#include <string>
+#include "benchmarks/linked/list_bench.h"
+#include "linked/singly_linked_list/singly_linked_list.h"
+
+using data_structures::linked::singly_linked_list;
+
+namespace benchmarks {
+
+/**
+ * std::forward_list has no push_back() or pop_back(), so those are only
+ * measured for our list; pop_back() is O(n) and runs one at a time.
+ */
+BENCHMARK_TEMPLATE(push_front, singly_linked_list<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(push_front, std::forward_list<int>)->Apply(sizes);
+
+BENCHMARK_TEMPLATE(push_back, singly_linked_list<int>)->Apply(sizes);
+
+BENCHMARK_TEMPLATE(push_back_copy, singly_linked_list<std::string>)->Apply(string_sizes);
+BENCHMARK_TEMPLATE(push_back_move, singly_linked_list<std::string>)->Apply(string_sizes);
+BENCHMARK_TEMPLATE(emplace_back, singly_linked_list<std::string>)->Apply(string_sizes);
+
+BENCHMARK_TEMPLATE(pop_front, singly_linked_list<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(pop_front, std::forward_list<int>)->Apply(sizes);
+
+BENCHMARK_TEMPLATE(pop_back_steady, singly_linked_list<int>)->Apply(sizes);
+
+BENCHMARK_TEMPLATE(at_middle, singly_linked_list<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(at_middle, std::forward_list<int>)->Apply(sizes);
+
+BENCHMARK_TEMPLATE(push_pop_middle, singly_linked_list<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(push_pop_middle, std::forward_list<int>)->Apply(sizes);
+
+BENCHMARK_TEMPLATE(traverse, singly_linked_list<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(traverse, std::forward_list<int>)->Apply(sizes);
+
+}
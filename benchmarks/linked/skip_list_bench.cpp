@@ -0,0 +1,39 @@
+#include <set>
+#include "benchmarks/linked/list_bench.h"
+#include "benchmarks/trees/tree_bench.h"
+#include "linked/doubly_linked_list/doubly_linked_list.h"
+#include "linked/skip_list/skip_list.h"
+#include "trees/avl_tree/avl_tree.h"
+
+using data_structures::linked::doubly_linked_list;
+using data_structures::linked::indexed_skip_list;
+using data_structures::linked::skip_list;
+using data_structures::trees::avl_tree;
+
+namespace benchmarks {
+
+/**< Positional access, where doubly_linked_list has to walk half the list */
+BENCHMARK_TEMPLATE(push_back, indexed_skip_list<int>)->Apply(sizes);
+
+BENCHMARK_TEMPLATE(at_middle, indexed_skip_list<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(at_middle, doubly_linked_list<int>)->Apply(sizes);
+
+BENCHMARK_TEMPLATE(push_pop_middle, indexed_skip_list<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(push_pop_middle, doubly_linked_list<int>)->Apply(sizes);
+
+BENCHMARK_TEMPLATE(traverse, indexed_skip_list<int>)->Apply(sizes);
+
+/**< Keyed access, against the balanced trees */
+BENCHMARK_TEMPLATE(insert, skip_list<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(insert, avl_tree<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(insert, std::set<int>)->Apply(sizes);
+
+BENCHMARK_TEMPLATE(has, skip_list<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(has, avl_tree<int>)->Apply(sizes);
+
+BENCHMARK_TEMPLATE(remove, skip_list<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(remove, avl_tree<int>)->Apply(sizes);
+
+BENCHMARK_TEMPLATE(iterate, skip_list<int>)->Apply(sizes);
+
+}
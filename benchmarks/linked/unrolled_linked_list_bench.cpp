@@ -0,0 +1,41 @@
+#include "benchmarks/linked/list_bench.h"
+#include "linked/doubly_linked_list/doubly_linked_list.h"
+#include "linked/unrolled_linked_list/unrolled_linked_list.h"
+
+using data_structures::linked::doubly_linked_list;
+using data_structures::linked::unrolled_linked_list;
+
+namespace benchmarks {
+
+/**
+ * The default blocks fill one cache line, 10 ints; the other block sizes
+ * show what skipping and splitting cost as blocks grow.
+ */
+using unrolled_4 = unrolled_linked_list<int, 4>;
+using unrolled_64 = unrolled_linked_list<int, 64>;
+
+BENCHMARK_TEMPLATE(push_back, unrolled_linked_list<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(push_back, doubly_linked_list<int>)->Apply(sizes);
+
+BENCHMARK_TEMPLATE(push_front, unrolled_linked_list<int>)->Apply(sizes);
+
+BENCHMARK_TEMPLATE(pop_front, unrolled_linked_list<int>)->Apply(sizes);
+
+BENCHMARK_TEMPLATE(pop_back, unrolled_linked_list<int>)->Apply(sizes);
+
+BENCHMARK_TEMPLATE(fifo_steady, unrolled_linked_list<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(fifo_steady, doubly_linked_list<int>)->Apply(sizes);
+
+BENCHMARK_TEMPLATE(at_middle, unrolled_linked_list<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(at_middle, unrolled_4)->Apply(sizes);
+BENCHMARK_TEMPLATE(at_middle, unrolled_64)->Apply(sizes);
+
+BENCHMARK_TEMPLATE(push_pop_middle, unrolled_linked_list<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(push_pop_middle, unrolled_4)->Apply(sizes);
+BENCHMARK_TEMPLATE(push_pop_middle, unrolled_64)->Apply(sizes);
+
+BENCHMARK_TEMPLATE(traverse, unrolled_linked_list<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(traverse, unrolled_4)->Apply(sizes);
+BENCHMARK_TEMPLATE(traverse, unrolled_64)->Apply(sizes);
+
+}
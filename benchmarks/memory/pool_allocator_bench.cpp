@@ -0,0 +1,47 @@
+#include <benchmark/benchmark.h>
+#include <memory>
+#include "linked/doubly_linked_list/doubly_linked_list.h"
+#include "linked/singly_linked_list/singly_linked_list.h"
+#include "memory/pool_allocator/pool_allocator.h"
+
+using data_structures::linked::doubly_linked_list;
+using data_structures::linked::singly_linked_list;
+using data_structures::memory::pool_allocator;
+
+/**< Queue-like churn: fill, then keep pushing on one end and popping the other */
+template<typename List>
+static void queue_churn(benchmark::State& state) {
+	const auto n = state.range(0);
+	List list;
+	for (auto i = 0; i < n; ++i)
+		list.push_back(i);
+
+	for (auto _ : state) {
+		list.push_back(42);
+		benchmark::DoNotOptimize(list.pop_front());
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+
+/**< Stack-like bursts: push n items then pop all of them */
+template<typename List>
+static void push_pop_burst(benchmark::State& state) {
+	const auto n = state.range(0);
+	List list;
+
+	for (auto _ : state) {
+		for (auto i = 0; i < n; ++i)
+			list.push_front(i);
+		for (auto i = 0; i < n; ++i)
+			benchmark::DoNotOptimize(list.pop_front());
+	}
+	state.SetItemsProcessed(state.iterations() * n);
+}
+
+BENCHMARK_TEMPLATE(queue_churn, doubly_linked_list<int, pool_allocator<int>>)->Arg(1 << 10);
+BENCHMARK_TEMPLATE(queue_churn, doubly_linked_list<int, std::allocator<int>>)->Arg(1 << 10);
+
+BENCHMARK_TEMPLATE(push_pop_burst, doubly_linked_list<int, pool_allocator<int>>)->Range(1 << 6, 1 << 16);
+BENCHMARK_TEMPLATE(push_pop_burst, doubly_linked_list<int, std::allocator<int>>)->Range(1 << 6, 1 << 16);
+BENCHMARK_TEMPLATE(push_pop_burst, singly_linked_list<int, pool_allocator<int>>)->Range(1 << 6, 1 << 16);
+BENCHMARK_TEMPLATE(push_pop_burst, singly_linked_list<int, std::allocator<int>>)->Range(1 << 6, 1 << 16);
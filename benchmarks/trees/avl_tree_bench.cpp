@@ -0,0 +1,321 @@
+#include <set>
+#include <string>
+#include "benchmarks/trees/tree_bench.h"
+#include "trees/avl_tree/avl_tree.h"
+
+using data_structures::trees::avl_tree;
+
+namespace benchmarks {
+
+/**< Loading a sorted snapshot, key by key or in bulk */
+template<typename Tree>
+void load_sorted(benchmark::State& state) {
+	std::vector<int> keys(state.range(0));
+	std::iota(keys.begin(), keys.end(), 0);
+	for (auto _ : state) {
+		Tree tree;
+		fill(tree, keys);
+		benchmark::DoNotOptimize(tree);
+	}
+	state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+void assign_sorted(benchmark::State& state) {
+	std::vector<int> keys(state.range(0));
+	std::iota(keys.begin(), keys.end(), 0);
+	for (auto _ : state) {
+		avl_tree<int> tree;
+		tree.assign_sorted(keys.begin(), keys.end());
+		benchmark::DoNotOptimize(tree);
+	}
+	state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+void set_range_sorted(benchmark::State& state) {
+	std::vector<int> keys(state.range(0));
+	std::iota(keys.begin(), keys.end(), 0);
+	for (auto _ : state) {
+		std::set<int> tree(keys.begin(), keys.end());
+		benchmark::DoNotOptimize(tree);
+	}
+	state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+/**< Merging a batch of n unsorted keys into a tree of n keys */
+void insert_range(benchmark::State& state) {
+	const auto keys = shuffled_keys(2 * state.range(0));
+	const auto middle = keys.begin() + state.range(0);
+	for (auto _ : state) {
+		state.PauseTiming();
+		avl_tree<int> tree(keys.begin(), middle);
+		state.ResumeTiming();
+		tree.insert_range(middle, keys.end());
+		benchmark::DoNotOptimize(tree);
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/**< Inserting n long strings by copy and by move */
+template<typename Tree>
+void insert_copy(benchmark::State& state) {
+	auto strings = long_strings(state.range(0));
+	std::shuffle(strings.begin(), strings.end(), std::mt19937(42));
+	for (auto _ : state) {
+		Tree tree;
+		for (const auto& item : strings)
+			tree.insert(item);
+		benchmark::DoNotOptimize(tree);
+	}
+	state.SetItemsProcessed(state.iterations() * strings.size());
+}
+
+template<typename Tree>
+void insert_move(benchmark::State& state) {
+	auto strings = long_strings(state.range(0));
+	std::shuffle(strings.begin(), strings.end(), std::mt19937(42));
+	for (auto _ : state) {
+		state.PauseTiming();
+		auto batch = strings;
+		state.ResumeTiming();
+		Tree tree;
+		for (auto& item : batch)
+			tree.insert(std::move(item));
+		benchmark::DoNotOptimize(tree);
+	}
+	state.SetItemsProcessed(state.iterations() * strings.size());
+}
+
+/**< k-th smallest key and key rank, std::set has to walk for both */
+void select(benchmark::State& state) {
+	const auto keys = shuffled_keys(state.range(0));
+	avl_tree<int> tree;
+	fill(tree, keys);
+
+	std::size_t i = 0;
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(tree.select(keys[i]));
+		if (++i == keys.size())
+			i = 0;
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+
+void rank(benchmark::State& state) {
+	const auto keys = shuffled_keys(state.range(0));
+	avl_tree<int> tree;
+	fill(tree, keys);
+
+	std::size_t i = 0;
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(tree.rank(keys[i]));
+		if (++i == keys.size())
+			i = 0;
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+
+void set_rank(benchmark::State& state) {
+	const auto keys = shuffled_keys(state.range(0));
+	std::set<int> tree;
+	fill(tree, keys);
+
+	std::size_t i = 0;
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(std::distance(tree.begin(), tree.find(keys[i])));
+		if (++i == keys.size())
+			i = 0;
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+
+template<typename Tree>
+void in_order(benchmark::State& state) {
+	Tree tree;
+	fill(tree, shuffled_keys(state.range(0)));
+	for (auto _ : state)
+		benchmark::DoNotOptimize(tree.in_order());
+	state.SetItemsProcessed(state.iterations() * tree.size());
+}
+
+template<typename Tree>
+void pre_order(benchmark::State& state) {
+	Tree tree;
+	fill(tree, shuffled_keys(state.range(0)));
+	for (auto _ : state)
+		benchmark::DoNotOptimize(tree.pre_order());
+	state.SetItemsProcessed(state.iterations() * tree.size());
+}
+
+template<typename Tree>
+void post_order(benchmark::State& state) {
+	Tree tree;
+	fill(tree, shuffled_keys(state.range(0)));
+	for (auto _ : state)
+		benchmark::DoNotOptimize(tree.post_order());
+	state.SetItemsProcessed(state.iterations() * tree.size());
+}
+
+template<typename Tree>
+void pre_order_view(benchmark::State& state) {
+	Tree tree;
+	fill(tree, shuffled_keys(state.range(0)));
+	for (auto _ : state) {
+		long sum = 0;
+		for (auto key : tree.pre_order_view())
+			sum += key;
+		benchmark::DoNotOptimize(sum);
+	}
+	state.SetItemsProcessed(state.iterations() * tree.size());
+}
+
+template<typename Tree>
+void post_order_view(benchmark::State& state) {
+	Tree tree;
+	fill(tree, shuffled_keys(state.range(0)));
+	for (auto _ : state) {
+		long sum = 0;
+		for (auto key : tree.post_order_view())
+			sum += key;
+		benchmark::DoNotOptimize(sum);
+	}
+	state.SetItemsProcessed(state.iterations() * tree.size());
+}
+
+/**< Snapshotting a tree of n keys, teardown of the copy included */
+template<typename Tree>
+void copy(benchmark::State& state) {
+	Tree tree;
+	fill(tree, shuffled_keys(state.range(0)));
+	for (auto _ : state) {
+		Tree snapshot(tree);
+		benchmark::DoNotOptimize(snapshot);
+	}
+	state.SetItemsProcessed(state.iterations() * tree.size());
+}
+
+/**< Draining a tree of n keys from the smallest, the way a scheduler takes its next job */
+void drain_pop_min(benchmark::State& state) {
+	const auto keys = shuffled_keys(state.range(0));
+	for (auto _ : state) {
+		state.PauseTiming();
+		avl_tree<int>* tree = new avl_tree<int>;
+		fill(*tree, keys);
+		state.ResumeTiming();
+		while (tree->size())
+			benchmark::DoNotOptimize(tree->pop_min());
+		state.PauseTiming();
+		delete tree;
+		state.ResumeTiming();
+	}
+	state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+/**< The same through in_order(), which copies every item for each pop; only small n are bearable */
+void drain_in_order_front(benchmark::State& state) {
+	const auto keys = shuffled_keys(state.range(0));
+	for (auto _ : state) {
+		state.PauseTiming();
+		avl_tree<int>* tree = new avl_tree<int>;
+		fill(*tree, keys);
+		state.ResumeTiming();
+		while (tree->size()) {
+			int least = tree->in_order().front();
+			tree->remove(least);
+			benchmark::DoNotOptimize(least);
+		}
+		state.PauseTiming();
+		delete tree;
+		state.ResumeTiming();
+	}
+	state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+void for_each_in_order(benchmark::State& state) {
+	avl_tree<int> tree;
+	fill(tree, shuffled_keys(state.range(0)));
+	for (auto _ : state) {
+		long sum = 0;
+		tree.for_each_in_order([&sum](int key) { sum += key; });
+		benchmark::DoNotOptimize(sum);
+	}
+	state.SetItemsProcessed(state.iterations() * tree.size());
+}
+
+/**< Summing the 100 keys of a random window, by visitor and by walking iterators on std::set */
+void for_each_in_range(benchmark::State& state) {
+	const auto keys = shuffled_keys(state.range(0));
+	avl_tree<int> tree;
+	fill(tree, keys);
+
+	std::size_t i = 0;
+	for (auto _ : state) {
+		long sum = 0;
+		tree.for_each_in_range(keys[i], keys[i] + 99, [&sum](int key) { sum += key; });
+		benchmark::DoNotOptimize(sum);
+		if (++i == keys.size())
+			i = 0;
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+
+void set_range(benchmark::State& state) {
+	const auto keys = shuffled_keys(state.range(0));
+	std::set<int> tree;
+	fill(tree, keys);
+
+	std::size_t i = 0;
+	for (auto _ : state) {
+		long sum = 0;
+		for (auto it = tree.lower_bound(keys[i]); it != tree.end() && *it <= keys[i] + 99; ++it)
+			sum += *it;
+		benchmark::DoNotOptimize(sum);
+		if (++i == keys.size())
+			i = 0;
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_TEMPLATE(insert, avl_tree<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(insert, std::set<int>)->Apply(sizes);
+
+BENCHMARK_TEMPLATE(load_sorted, avl_tree<int>)->Apply(sizes);
+BENCHMARK(assign_sorted)->Apply(sizes);
+BENCHMARK(set_range_sorted)->Apply(sizes);
+BENCHMARK(insert_range)->Apply(sizes);
+
+BENCHMARK_TEMPLATE(insert_copy, avl_tree<std::string>)->Apply(string_sizes);
+BENCHMARK_TEMPLATE(insert_copy, std::set<std::string>)->Apply(string_sizes);
+BENCHMARK_TEMPLATE(insert_move, avl_tree<std::string>)->Apply(string_sizes);
+BENCHMARK_TEMPLATE(insert_move, std::set<std::string>)->Apply(string_sizes);
+
+BENCHMARK_TEMPLATE(has, avl_tree<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(has, std::set<int>)->Apply(sizes);
+
+BENCHMARK_TEMPLATE(remove, avl_tree<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(remove, std::set<int>)->Apply(sizes);
+
+BENCHMARK(select)->Apply(sizes);
+BENCHMARK(rank)->Apply(sizes);
+BENCHMARK(set_rank)->Apply(sizes);
+
+BENCHMARK_TEMPLATE(iterate, avl_tree<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(iterate, std::set<int>)->Apply(sizes);
+
+BENCHMARK_TEMPLATE(in_order, avl_tree<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(pre_order, avl_tree<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(post_order, avl_tree<int>)->Apply(sizes);
+
+BENCHMARK_TEMPLATE(copy, avl_tree<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(copy, std::set<int>)->Apply(sizes);
+
+BENCHMARK(for_each_in_order)->Apply(sizes);
+BENCHMARK(for_each_in_range)->Apply(sizes);
+BENCHMARK(set_range)->Apply(sizes);
+
+BENCHMARK(drain_pop_min)->Apply(sizes);
+BENCHMARK(drain_in_order_front)->RangeMultiplier(10)->Range(100, 10000);
+
+BENCHMARK_TEMPLATE(pre_order_view, avl_tree<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(post_order_view, avl_tree<int>)->Apply(sizes);
+
+}
@@ -0,0 +1,45 @@
+#include "benchmarks/trees/tree_bench.h"
+#include "trees/avl_tree/avl_tree.h"
+#include "trees/b_tree/b_tree.h"
+
+using data_structures::trees::avl_tree;
+using data_structures::trees::b_tree;
+
+namespace benchmarks {
+
+/**< Lookup of a random key followed by an in-order walk over the next 100 */
+template<typename Tree>
+void range_scan(benchmark::State& state) {
+	const auto keys = shuffled_keys(state.range(0));
+	Tree tree;
+	fill(tree, keys);
+
+	std::size_t i = 0;
+	for (auto _ : state) {
+		long sum = 0;
+		auto it = tree.lower_bound(keys[i]);
+		for (int n = 0; n < 100 && it != tree.end(); ++n, ++it)
+			sum += *it;
+		benchmark::DoNotOptimize(sum);
+		if (++i == keys.size())
+			i = 0;
+	}
+	state.SetItemsProcessed(state.iterations() * 100);
+}
+
+BENCHMARK_TEMPLATE(insert, b_tree<int>)->Apply(large_sizes);
+BENCHMARK_TEMPLATE(insert, avl_tree<int>)->Apply(large_sizes);
+
+BENCHMARK_TEMPLATE(has, b_tree<int>)->Apply(large_sizes);
+BENCHMARK_TEMPLATE(has, avl_tree<int>)->Apply(large_sizes);
+
+BENCHMARK_TEMPLATE(remove, b_tree<int>)->Apply(large_sizes);
+BENCHMARK_TEMPLATE(remove, avl_tree<int>)->Apply(large_sizes);
+
+BENCHMARK_TEMPLATE(range_scan, b_tree<int>)->Apply(large_sizes);
+BENCHMARK_TEMPLATE(range_scan, avl_tree<int>)->Apply(large_sizes);
+
+BENCHMARK_TEMPLATE(iterate, b_tree<int>)->Apply(large_sizes);
+BENCHMARK_TEMPLATE(iterate, avl_tree<int>)->Apply(large_sizes);
+
+}
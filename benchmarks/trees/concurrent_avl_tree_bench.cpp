@@ -0,0 +1,81 @@
+#include <mutex>
+#include "benchmarks/trees/tree_bench.h"
+#include "trees/avl_tree/avl_tree.h"
+#include "trees/concurrent_avl_tree/concurrent_avl_tree.h"
+
+using data_structures::trees::avl_tree;
+using data_structures::trees::concurrent_avl_tree;
+
+namespace benchmarks {
+
+/**< A tree behind one global mutex, which is what sharing avl_tree takes */
+template<typename Tree>
+class locked {
+public:
+	bool has(int key) const {
+		std::lock_guard<std::mutex> lock(_mutex);
+		return _tree.has(key);
+	}
+
+	void insert(int key) {
+		std::lock_guard<std::mutex> lock(_mutex);
+		_tree.insert(key);
+	}
+
+	void remove(int key) {
+		std::lock_guard<std::mutex> lock(_mutex);
+		_tree.remove(key);
+	}
+
+private:
+	mutable std::mutex _mutex;
+	Tree _tree;
+};
+
+/**
+ * Every thread runs the same mix of lookups and writes on one shared tree of
+ * n keys. Writes insert and then remove keys from a range of the thread's
+ * own, so the tree keeps its size, give or take a key per thread, and no
+ * write ever throws.
+ */
+template<typename Tree, int ReadPercent>
+void mix(benchmark::State& state) {
+	static Tree* tree;
+	const int n = state.range(0);
+	if (state.thread_index() == 0) {
+		tree = new Tree;
+		fill(*tree, shuffled_keys(n));
+	}
+
+	std::minstd_rand random(state.thread_index() + 1);
+	const int first = n + state.thread_index() * n;
+	int key = first;
+	bool inserted = false;
+
+	for (auto _ : state) {
+		if (static_cast<int>(random() % 100) < ReadPercent) {
+			benchmark::DoNotOptimize(tree->has(random() % n));
+		} else if (!inserted) {
+			tree->insert(key);
+			inserted = true;
+		} else {
+			tree->remove(key);
+			inserted = false;
+			if (++key == first + n)
+				key = first;
+		}
+	}
+	state.SetItemsProcessed(state.iterations());
+
+	// A key some thread left inserted goes with the tree; removing it here could race the delete.
+	if (state.thread_index() == 0)
+		delete tree;
+}
+
+BENCHMARK_TEMPLATE(mix, concurrent_avl_tree<int>, 95)->Arg(1000000)->Apply(thread_counts);
+BENCHMARK_TEMPLATE(mix, locked<avl_tree<int>>, 95)->Arg(1000000)->Apply(thread_counts);
+
+BENCHMARK_TEMPLATE(mix, concurrent_avl_tree<int>, 50)->Arg(1000000)->Apply(thread_counts);
+BENCHMARK_TEMPLATE(mix, locked<avl_tree<int>>, 50)->Arg(1000000)->Apply(thread_counts);
+
+}
@@ -0,0 +1,62 @@
+#include "benchmarks/trees/tree_bench.h"
+#include "trees/avl_tree/avl_tree.h"
+#include "trees/persistent_avl_tree/persistent_avl_tree.h"
+
+using data_structures::trees::avl_tree;
+using data_structures::trees::persistent_avl_tree;
+
+namespace benchmarks {
+
+/**< Taking a snapshot of a tree of n keys, teardown included */
+template<typename Tree>
+void take_snapshot(benchmark::State& state) {
+	Tree tree;
+	fill(tree, shuffled_keys(state.range(0)));
+	for (auto _ : state) {
+		Tree snapshot(tree);
+		benchmark::DoNotOptimize(snapshot);
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+
+/**
+ * A writer keeping n keys, replacing the oldest key by a new one per
+ * update and publishing a snapshot every 64 updates, the published one
+ * living until the next. Each iteration is one batch and its publication.
+ */
+template<typename Tree>
+void publish(benchmark::State& state) {
+	const std::size_t n = state.range(0);
+	const auto keys = shuffled_keys(2 * n);
+	Tree tree;
+	for (std::size_t i = 0; i < n; ++i)
+		tree.insert(keys[i]);
+
+	Tree published;
+	std::size_t oldest = 0;
+	for (auto _ : state) {
+		for (int update = 0; update < 64; ++update) {
+			tree.remove(keys[oldest]);
+			tree.insert(keys[(oldest + n) % keys.size()]);
+			if (++oldest == keys.size())
+				oldest = 0;
+		}
+		published = tree;
+		benchmark::DoNotOptimize(published);
+	}
+	state.SetItemsProcessed(state.iterations() * 64);
+}
+
+BENCHMARK_TEMPLATE(insert, persistent_avl_tree<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(insert, avl_tree<int>)->Apply(sizes);
+
+BENCHMARK_TEMPLATE(has, persistent_avl_tree<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(has, avl_tree<int>)->Apply(sizes);
+
+BENCHMARK_TEMPLATE(take_snapshot, persistent_avl_tree<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(take_snapshot, avl_tree<int>)->Apply(sizes);
+
+BENCHMARK_TEMPLATE(publish, persistent_avl_tree<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(publish, avl_tree<int>)->Apply(sizes);
+
+}
@@ -0,0 +1,76 @@
+#ifndef TREE_BENCH_H_
+#define TREE_BENCH_H_
+
+#include "benchmarks/bench.h"
+
+namespace benchmarks {
+
+template<typename Tree>
+void fill(Tree& tree, const std::vector<int>& keys) {
+	for (auto key : keys)
+		tree.insert(key);
+}
+
+/**< Batches of n inserts in random order into an empty tree, teardown included */
+template<typename Tree>
+void insert(benchmark::State& state) {
+	const auto keys = shuffled_keys(state.range(0));
+	for (auto _ : state) {
+		Tree tree;
+		fill(tree, keys);
+		benchmark::DoNotOptimize(tree);
+	}
+	state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+/**< Successful lookups in random order on a tree of n keys */
+template<typename Tree>
+void has(benchmark::State& state) {
+	const auto keys = shuffled_keys(state.range(0));
+	Tree tree;
+	fill(tree, keys);
+
+	std::size_t i = 0;
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(ops::has(tree, keys[i]));
+		if (++i == keys.size())
+			i = 0;
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+
+/**< Batches of n removals in random order, with the refill kept out of the measurement */
+template<typename Tree>
+void remove(benchmark::State& state) {
+	const auto keys = shuffled_keys(state.range(0));
+	for (auto _ : state) {
+		state.PauseTiming();
+		Tree* tree = new Tree;
+		fill(*tree, keys);
+		state.ResumeTiming();
+		for (auto key : keys)
+			ops::remove(*tree, key);
+		state.PauseTiming();
+		delete tree;
+		state.ResumeTiming();
+	}
+	state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+/**< In-order walk through iterators, without building a container */
+template<typename Tree>
+void iterate(benchmark::State& state) {
+	Tree tree;
+	fill(tree, shuffled_keys(state.range(0)));
+	for (auto _ : state) {
+		long sum = 0;
+		for (auto key : tree)
+			sum += key;
+		benchmark::DoNotOptimize(sum);
+	}
+	state.SetItemsProcessed(state.iterations() * tree.size());
+}
+
+}
+
+#endif /* TREE_BENCH_H_ */
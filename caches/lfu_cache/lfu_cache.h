@@ -0,0 +1,225 @@
+#ifndef LFU_CACHE_H_
+#define LFU_CACHE_H_
+
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include "caches/lru_cache/lru_cache.h"
+#include "linked/doubly_linked_list/doubly_linked_list.h"
+#include "memory/pool_allocator/pool_allocator.h"
+
+namespace data_structures {
+namespace caches {
+
+/**
+ * Map of at most capacity weight, dropping the least frequently used
+ * entries to make room, the least recent first among equals. Interface
+ * and weights as in lru_cache.
+ *
+ * All entries share one doubly_linked_list, ordered by use count and then
+ * by recency, so the victim is always at the front. Each count maps to the
+ * last entry using it: a touched entry is spliced right after the last
+ * entry of the next count, which keeps get, put and evictions O(1).
+ */
+template<typename K, typename V, typename Weigher = unit_weight,
+		typename Hash = std::hash<K>, typename KeyEqual = std::equal_to<K>>
+class lfu_cache {
+private:
+	using size_type = std::size_t;
+
+	struct entry {
+		entry(const K& key, V&& value, size_type weight) :
+				_key(key), _value(std::move(value)), _weight(weight) {
+		}
+
+		K _key;
+		V _value;
+		size_type _weight;
+		size_type _count { 1 };
+	};
+
+	using list = linked::doubly_linked_list<entry>;
+	using iterator = typename list::iterator;
+	using index = std::unordered_map<K, iterator, Hash, KeyEqual,
+			memory::pool_allocator<std::pair<const K, iterator>>>;
+	using tails = std::unordered_map<size_type, iterator, std::hash<size_type>, std::equal_to<size_type>,
+			memory::pool_allocator<std::pair<const size_type, iterator>>>;
+
+public:
+	explicit lfu_cache(size_type capacity, const Weigher& weigher = Weigher()) :
+			_capacity(capacity), _weigher(weigher) {
+		if (capacity == 0)
+			throw std::invalid_argument("Cache capacity must be positive.");
+	}
+
+	/**< The value cached for key, counting one more use, or nullptr; valid until the next put */
+	const V* get(const K& key) {
+		auto found = _index.find(key);
+		if (found == _index.end()) {
+			++_misses;
+			return nullptr;
+		}
+
+		++_hits;
+		touch(found->second);
+		return &found->second->_value;
+	}
+
+	/**
+	 * Caches value for key, replacing any previous one, which counts as a
+	 * use; new entries start at one use. Then evicts other entries until the
+	 * weight fits, so a newcomer is never its own victim. An entry heavier
+	 * than the whole capacity only drops the previous one and counts as
+	 * evicted.
+	 */
+	void put(const K& key, V value) {
+		const size_type weight = _weigher(key, value);
+		if (weight > _capacity) {
+			remove(key);
+			++_evictions;
+			return;
+		}
+
+		iterator item = _entries.end();
+		auto found = _index.find(key);
+		if (found != _index.end()) {
+			item = found->second;
+			_weight = _weight - item->_weight + weight;
+			item->_value = std::move(value);
+			item->_weight = weight;
+			touch(item);
+		} else {
+			auto tail = _tails.find(1);
+			iterator position = _entries.begin();
+			if (tail != _tails.end())
+				position = ++iterator(tail->second);
+			item = _entries.emplace(position, key, std::move(value), weight);
+			_index.emplace(key, item);
+			if (tail != _tails.end())
+				tail->second = item;
+			else
+				_tails.emplace(1, item);
+			_weight += weight;
+		}
+
+		while (_weight > _capacity)
+			evict(item);
+	}
+
+	/**< Whether key is cached, without counting nor touching it */
+	bool has(const K& key) const {
+		return _index.find(key) != _index.end();
+	}
+
+	/**< Drops key, returning whether it was cached */
+	bool remove(const K& key) {
+		auto found = _index.find(key);
+		if (found == _index.end())
+			return false;
+
+		drop(found->second);
+		_index.erase(found);
+		return true;
+	}
+
+	void clear() {
+		_index.clear();
+		_tails.clear();
+		_entries = list();
+		_weight = 0;
+	}
+
+	/**< Uses counted for key, 0 when it is not cached */
+	size_type count(const K& key) const {
+		auto found = _index.find(key);
+		return found == _index.end() ? 0 : found->second->_count;
+	}
+
+	size_type size() const {
+		return _entries.size();
+	}
+
+	/**< Total weight of the cached entries, never above capacity() */
+	size_type weight() const {
+		return _weight;
+	}
+
+	size_type capacity() const {
+		return _capacity;
+	}
+
+	/**< Counters since construction */
+	size_type hits() const {
+		return _hits;
+	}
+
+	size_type misses() const {
+		return _misses;
+	}
+
+	size_type evictions() const {
+		return _evictions;
+	}
+
+private:
+	/**< Moves item from its count to the next one, behind the entries already there */
+	void touch(iterator item) {
+		const size_type count = item->_count;
+		auto tail = _tails.find(count);
+		auto next = _tails.find(count + 1);
+		iterator position = ++iterator(next != _tails.end() ? next->second : tail->second);
+
+		leave_group(item, tail);
+		_entries.splice(position, _entries, item);
+		item->_count = count + 1;
+		if (next != _tails.end())
+			next->second = item;
+		else
+			_tails.emplace(count + 1, item);
+	}
+
+	/**< Hands the tail of item's count over to its predecessor, or drops the count */
+	void leave_group(iterator item, typename tails::iterator tail) {
+		if (tail->second != item)
+			return;
+
+		iterator pred = --iterator(item);
+		if (pred != _entries.end() && pred->_count == item->_count)
+			tail->second = pred;
+		else
+			_tails.erase(tail);
+	}
+
+	void drop(iterator item) {
+		leave_group(item, _tails.find(item->_count));
+		_weight -= item->_weight;
+		_entries.erase(item);
+	}
+
+	/**< Evicts the front entry, or the one after it when the front is keep */
+	void evict(iterator keep) {
+		iterator victim = _entries.begin();
+		if (victim == keep)
+			++victim;
+		_index.erase(victim->_key);
+		drop(victim);
+		++_evictions;
+	}
+
+	size_type _capacity;
+	Weigher _weigher;
+	list _entries;
+	index _index;
+	tails _tails;
+	size_type _weight { 0 };
+	size_type _hits { 0 };
+	size_type _misses { 0 };
+	size_type _evictions { 0 };
+};
+
+}
+}
+
+#endif /* LFU_CACHE_H_ */
@@ -0,0 +1,164 @@
+#include <gtest/gtest.h>
+#include <random>
+#include <string>
+#include <vector>
+#include "lfu_cache.h"
+
+using data_structures::caches::lfu_cache;
+
+/**< Weighs string values by their length, bounding the cache in bytes */
+struct string_bytes {
+	std::size_t operator()(int, const std::string& value) const {
+		return value.size();
+	}
+};
+
+class lfu_cache_test: public testing::Test {
+public:
+	lfu_cache<int, int> cache { 3 };
+};
+
+TEST_F(lfu_cache_test, isCreatedEmpty) {
+	EXPECT_EQ(0, cache.size());
+	EXPECT_EQ(3, cache.capacity());
+	EXPECT_EQ(nullptr, cache.get(42));
+	EXPECT_EQ(0, cache.count(42));
+	EXPECT_THROW((lfu_cache<int, int>(0)), std::invalid_argument);
+}
+
+TEST_F(lfu_cache_test, countsUses) {
+	cache.put(1, 10);
+	EXPECT_EQ(1, cache.count(1));
+	EXPECT_EQ(10, *cache.get(1));
+	cache.put(1, 11);
+	EXPECT_EQ(3, cache.count(1));
+	EXPECT_EQ(11, *cache.get(1));
+	EXPECT_EQ(nullptr, cache.get(2));
+	EXPECT_EQ(2, cache.hits());
+	EXPECT_EQ(1, cache.misses());
+}
+
+TEST_F(lfu_cache_test, evictsLeastFrequentlyUsed) {
+	cache.put(1, 10);
+	cache.put(2, 20);
+	cache.put(3, 30);
+	cache.get(1);
+	cache.get(1);
+	cache.get(3);
+	cache.put(4, 40);
+	EXPECT_FALSE(cache.has(2));
+	EXPECT_EQ(1, cache.evictions());
+
+	// 3 has been used twice, so the fresh 4 goes first.
+	cache.put(5, 50);
+	EXPECT_FALSE(cache.has(4));
+	EXPECT_TRUE(cache.has(3));
+	EXPECT_TRUE(cache.has(1));
+}
+
+TEST_F(lfu_cache_test, tiesEvictTheLeastRecent) {
+	cache.put(1, 10);
+	cache.put(2, 20);
+	cache.put(3, 30);
+	cache.get(2);
+	cache.get(1);
+	cache.get(3);
+	cache.put(4, 40);
+	EXPECT_FALSE(cache.has(2));
+	EXPECT_TRUE(cache.has(4));
+
+	cache.get(4);
+	cache.put(5, 50);
+	EXPECT_FALSE(cache.has(1));
+	EXPECT_TRUE(cache.has(3));
+	EXPECT_TRUE(cache.has(4));
+	EXPECT_TRUE(cache.has(5));
+}
+
+TEST_F(lfu_cache_test, weigherBoundsTheTotal) {
+	lfu_cache<int, std::string, string_bytes> bytes(10);
+	bytes.put(1, "aaaa");
+	bytes.get(1);
+	bytes.put(2, "bbbb");
+	bytes.put(3, "cccc");
+	EXPECT_TRUE(bytes.has(1));
+	EXPECT_FALSE(bytes.has(2));
+	EXPECT_EQ(8, bytes.weight());
+
+	bytes.put(4, std::string(11, 'd'));
+	EXPECT_FALSE(bytes.has(4));
+	EXPECT_TRUE(bytes.has(3));
+	EXPECT_EQ(8, bytes.weight());
+	EXPECT_EQ(2, bytes.evictions());
+}
+
+TEST_F(lfu_cache_test, removeAndClear) {
+	cache.put(1, 10);
+	cache.put(2, 20);
+	cache.get(2);
+	EXPECT_TRUE(cache.remove(2));
+	EXPECT_FALSE(cache.remove(2));
+	cache.put(3, 30);
+	cache.put(4, 40);
+	cache.put(5, 50);
+	EXPECT_FALSE(cache.has(1));
+
+	cache.clear();
+	EXPECT_EQ(0, cache.size());
+	cache.put(6, 60);
+	EXPECT_EQ(60, *cache.get(6));
+}
+
+/**< Among the entries already cached, the victim has the fewest uses, then the oldest last use */
+TEST_F(lfu_cache_test, randomOperationsMatchReference) {
+	struct model {
+		int key;
+		int value;
+		std::size_t count;
+		int used;
+	};
+
+	lfu_cache<int, int> large(100);
+	std::vector<model> reference;
+	auto lookup = [&](int key) {
+		for (auto it = reference.begin(); it != reference.end(); ++it)
+			if (it->key == key)
+				return it;
+		return reference.end();
+	};
+
+	std::mt19937 random(42);
+	for (int i = 0; i < 20000; ++i) {
+		int key = random() % 300;
+		auto found = lookup(key);
+		if (random() % 2) {
+			const int* value = large.get(key);
+			ASSERT_EQ(found != reference.end(), value != nullptr);
+			if (value != nullptr) {
+				ASSERT_EQ(found->value, *value);
+				++found->count;
+				found->used = i;
+			}
+		} else {
+			large.put(key, i);
+			if (found != reference.end()) {
+				found->value = i;
+				++found->count;
+				found->used = i;
+			} else {
+				if (reference.size() == 100) {
+					auto victim = reference.begin();
+					for (auto it = reference.begin(); it != reference.end(); ++it)
+						if (it->count < victim->count || (it->count == victim->count && it->used < victim->used))
+							victim = it;
+					reference.erase(victim);
+				}
+				reference.push_back({ key, i, 1, i });
+			}
+		}
+		ASSERT_EQ(reference.size(), large.size());
+	}
+
+	for (const auto& item : reference)
+		EXPECT_EQ(item.count, large.count(item.key));
+}
@@ -0,0 +1,173 @@
+#ifndef LRU_CACHE_H_
+#define LRU_CACHE_H_
+
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include "linked/doubly_linked_list/doubly_linked_list.h"
+#include "memory/pool_allocator/pool_allocator.h"
+
+namespace data_structures {
+namespace caches {
+
+/**< Weighs every entry as 1, so capacities count entries */
+struct unit_weight {
+	template<typename K, typename V>
+	std::size_t operator()(const K&, const V&) const {
+		return 1;
+	}
+};
+
+/**
+ * Map of at most capacity weight, dropping the least recently used entries
+ * to make room. Weigher gives the weight of an entry, e.g. its size in
+ * bytes; by default capacities count entries.
+ *
+ * Entries are kept in a doubly_linked_list, most recent first, indexed by
+ * a hash map; both allocate from pools. get, put and evictions are O(1).
+ */
+template<typename K, typename V, typename Weigher = unit_weight,
+		typename Hash = std::hash<K>, typename KeyEqual = std::equal_to<K>>
+class lru_cache {
+private:
+	struct entry {
+		entry(const K& key, V&& value, std::size_t weight) :
+				_key(key), _value(std::move(value)), _weight(weight) {
+		}
+
+		K _key;
+		V _value;
+		std::size_t _weight;
+	};
+
+	using list = linked::doubly_linked_list<entry>;
+	using iterator = typename list::iterator;
+	using index = std::unordered_map<K, iterator, Hash, KeyEqual,
+			memory::pool_allocator<std::pair<const K, iterator>>>;
+	using size_type = std::size_t;
+
+public:
+	explicit lru_cache(size_type capacity, const Weigher& weigher = Weigher()) :
+			_capacity(capacity), _weigher(weigher) {
+		if (capacity == 0)
+			throw std::invalid_argument("Cache capacity must be positive.");
+	}
+
+	/**< The value cached for key, made the most recent, or nullptr; valid until the next put */
+	const V* get(const K& key) {
+		auto found = _index.find(key);
+		if (found == _index.end()) {
+			++_misses;
+			return nullptr;
+		}
+
+		++_hits;
+		_entries.move_to_front(found->second);
+		return &found->second->_value;
+	}
+
+	/**
+	 * Caches value for key as the most recent entry, replacing any previous
+	 * one, then evicts from the least recent end until the weight fits. An
+	 * entry heavier than the whole capacity only drops the previous one and
+	 * counts as evicted.
+	 */
+	void put(const K& key, V value) {
+		const size_type weight = _weigher(key, value);
+		if (weight > _capacity) {
+			remove(key);
+			++_evictions;
+			return;
+		}
+
+		auto found = _index.find(key);
+		if (found != _index.end()) {
+			entry& item = *found->second;
+			_weight = _weight - item._weight + weight;
+			item._value = std::move(value);
+			item._weight = weight;
+			_entries.move_to_front(found->second);
+		} else {
+			_entries.emplace_front(key, std::move(value), weight);
+			_index.emplace(key, _entries.begin());
+			_weight += weight;
+		}
+
+		while (_weight > _capacity)
+			evict();
+	}
+
+	/**< Whether key is cached, without counting nor touching it */
+	bool has(const K& key) const {
+		return _index.find(key) != _index.end();
+	}
+
+	/**< Drops key, returning whether it was cached */
+	bool remove(const K& key) {
+		auto found = _index.find(key);
+		if (found == _index.end())
+			return false;
+
+		_weight -= found->second->_weight;
+		_entries.erase(found->second);
+		_index.erase(found);
+		return true;
+	}
+
+	void clear() {
+		_index.clear();
+		_entries = list();
+		_weight = 0;
+	}
+
+	size_type size() const {
+		return _entries.size();
+	}
+
+	/**< Total weight of the cached entries, never above capacity() */
+	size_type weight() const {
+		return _weight;
+	}
+
+	size_type capacity() const {
+		return _capacity;
+	}
+
+	/**< Counters since construction */
+	size_type hits() const {
+		return _hits;
+	}
+
+	size_type misses() const {
+		return _misses;
+	}
+
+	size_type evictions() const {
+		return _evictions;
+	}
+
+private:
+	void evict() {
+		iterator victim = _entries.rbegin();
+		_weight -= victim->_weight;
+		_index.erase(victim->_key);
+		_entries.erase(victim);
+		++_evictions;
+	}
+
+	size_type _capacity;
+	Weigher _weigher;
+	list _entries;
+	index _index;
+	size_type _weight { 0 };
+	size_type _hits { 0 };
+	size_type _misses { 0 };
+	size_type _evictions { 0 };
+};
+
+}
+}
+
+#endif /* LRU_CACHE_H_ */
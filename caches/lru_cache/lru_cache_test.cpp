@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <list>
+#include <random>
+#include <string>
+#include <utility>
+#include "lru_cache.h"
+
+using data_structures::caches::lru_cache;
+
+/**< Weighs string values by their length, bounding the cache in bytes */
+struct string_bytes {
+	std::size_t operator()(int, const std::string& value) const {
+		return value.size();
+	}
+};
+
+class lru_cache_test: public testing::Test {
+public:
+	lru_cache<int, int> cache { 3 };
+};
+
+TEST_F(lru_cache_test, isCreatedEmpty) {
+	EXPECT_EQ(0, cache.size());
+	EXPECT_EQ(3, cache.capacity());
+	EXPECT_EQ(nullptr, cache.get(42));
+	EXPECT_THROW((lru_cache<int, int>(0)), std::invalid_argument);
+}
+
+TEST_F(lru_cache_test, countsHitsAndMisses) {
+	EXPECT_EQ(nullptr, cache.get(1));
+	cache.put(1, 10);
+	ASSERT_NE(nullptr, cache.get(1));
+	EXPECT_EQ(10, *cache.get(1));
+	EXPECT_TRUE(cache.has(1));
+	EXPECT_FALSE(cache.has(2));
+	EXPECT_EQ(2, cache.hits());
+	EXPECT_EQ(1, cache.misses());
+	EXPECT_EQ(0, cache.evictions());
+}
+
+TEST_F(lru_cache_test, evictsLeastRecentlyUsed) {
+	cache.put(1, 10);
+	cache.put(2, 20);
+	cache.put(3, 30);
+	cache.get(1);
+	cache.put(4, 40);
+	EXPECT_FALSE(cache.has(2));
+	EXPECT_EQ(3, cache.size());
+	EXPECT_EQ(1, cache.evictions());
+
+	cache.put(3, 31);
+	cache.put(5, 50);
+	EXPECT_FALSE(cache.has(1));
+	EXPECT_EQ(31, *cache.get(3));
+	EXPECT_EQ(2, cache.evictions());
+}
+
+TEST_F(lru_cache_test, weigherBoundsTheTotal) {
+	lru_cache<int, std::string, string_bytes> bytes(10);
+	bytes.put(1, "aaaa");
+	bytes.put(2, "bbbb");
+	EXPECT_EQ(8, bytes.weight());
+	bytes.put(3, "cccc");
+	EXPECT_FALSE(bytes.has(1));
+	EXPECT_EQ(8, bytes.weight());
+
+	bytes.put(2, "bbbbbbbb");
+	EXPECT_FALSE(bytes.has(3));
+	EXPECT_EQ(8, bytes.weight());
+
+	bytes.put(4, std::string(11, 'd'));
+	EXPECT_FALSE(bytes.has(4));
+	EXPECT_EQ(1, bytes.size());
+	EXPECT_EQ(8, bytes.weight());
+	EXPECT_EQ(3, bytes.evictions());
+
+	bytes.put(2, std::string(11, 'b'));
+	EXPECT_FALSE(bytes.has(2));
+	EXPECT_EQ(0, bytes.weight());
+}
+
+TEST_F(lru_cache_test, removeAndClear) {
+	cache.put(1, 10);
+	cache.put(2, 20);
+	EXPECT_TRUE(cache.remove(1));
+	EXPECT_FALSE(cache.remove(1));
+	EXPECT_EQ(1, cache.size());
+
+	cache.clear();
+	EXPECT_EQ(0, cache.size());
+	EXPECT_EQ(0, cache.weight());
+	cache.put(3, 30);
+	EXPECT_EQ(30, *cache.get(3));
+}
+
+TEST_F(lru_cache_test, randomOperationsMatchReference) {
+	lru_cache<int, int> large(100);
+	std::list<std::pair<int, int>> reference;
+	auto lookup = [&](int key) {
+		return std::find_if(reference.begin(), reference.end(),
+				[key](const std::pair<int, int>& item) { return item.first == key; });
+	};
+
+	std::mt19937 random(42);
+	for (int i = 0; i < 20000; ++i) {
+		int key = random() % 300;
+		auto found = lookup(key);
+		if (random() % 2) {
+			const int* value = large.get(key);
+			ASSERT_EQ(found != reference.end(), value != nullptr);
+			if (value != nullptr) {
+				ASSERT_EQ(found->second, *value);
+				reference.splice(reference.begin(), reference, found);
+			}
+		} else {
+			large.put(key, i);
+			if (found != reference.end())
+				reference.erase(found);
+			reference.emplace_front(key, i);
+			if (reference.size() > 100)
+				reference.pop_back();
+		}
+		ASSERT_EQ(reference.size(), large.size());
+	}
+
+	for (const auto& item : reference)
+		EXPECT_TRUE(large.has(item.first));
+}
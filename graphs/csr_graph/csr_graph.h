@@ -0,0 +1,435 @@
+#ifndef CSR_GRAPH_H_
+#define CSR_GRAPH_H_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <queue>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace data_structures {
+namespace graphs {
+
+/**
+ * Immutable directed graph in compressed sparse row form: the targets of
+ * every vertex lie next to each other in one array, found through an array
+ * of offsets, so walking the edges of a vertex is a linear scan without a
+ * pointer chase. The sources of every vertex are kept the same way for the
+ * algorithms that walk edges backwards.
+ *
+ * Vertices are 0..vertices()-1. Building from an edge list is a counting
+ * sort, O(V+E), and keeps the edges of each vertex in input order.
+ */
+template<typename Weight = unsigned>
+class csr_graph {
+public:
+	using vertex = std::uint32_t;
+	using size_type = std::size_t;
+	using weight_type = Weight;
+
+	/**< Distance bfs() gives to vertices the source cannot reach */
+	static constexpr size_type unreachable = size_type(-1);
+
+	struct edge {
+		edge(vertex from, vertex to, Weight weight = Weight(1)) :
+				_from(from), _to(to), _weight(weight) {
+		}
+
+		vertex _from;
+		vertex _to;
+		Weight _weight;
+	};
+
+	/**< Contiguous run of targets, sources or weights of one vertex */
+	template<typename T>
+	class slice {
+	public:
+		slice(const T* first, const T* last) :
+				_first(first), _last(last) {
+		}
+
+		const T* begin() const {
+			return _first;
+		}
+
+		const T* end() const {
+			return _last;
+		}
+
+		size_type size() const {
+			return _last - _first;
+		}
+
+		const T& operator[](size_type index) const {
+			return _first[index];
+		}
+
+	private:
+		const T* _first;
+		const T* _last;
+	};
+
+	csr_graph() :
+			_offsets(1, 0), _in_offsets(1, 0) {
+	}
+
+	csr_graph(size_type vertices, const std::vector<edge>& edges) {
+		build(vertices, edges.begin(), edges.end());
+	}
+
+	csr_graph(size_type vertices, std::initializer_list<edge> edges) {
+		build(vertices, edges.begin(), edges.end());
+	}
+
+	size_type vertices() const {
+		return _offsets.size() - 1;
+	}
+
+	size_type edges() const {
+		return _targets.size();
+	}
+
+	/**< Out-degree of v */
+	size_type degree(vertex v) const {
+		check(v);
+		return _offsets[v + 1] - _offsets[v];
+	}
+
+	size_type in_degree(vertex v) const {
+		check(v);
+		return _in_offsets[v + 1] - _in_offsets[v];
+	}
+
+	/**< Targets of the edges leaving v, in input order */
+	slice<vertex> neighbours(vertex v) const {
+		check(v);
+		return {_targets.data() + _offsets[v], _targets.data() + _offsets[v + 1]};
+	}
+
+	/**< Weights of the edges leaving v, matching neighbours(v) */
+	slice<Weight> weights(vertex v) const {
+		check(v);
+		return {_weights.data() + _offsets[v], _weights.data() + _offsets[v + 1]};
+	}
+
+	/**< Sources of the edges entering v */
+	slice<vertex> predecessors(vertex v) const {
+		check(v);
+		return {_sources.data() + _in_offsets[v], _sources.data() + _in_offsets[v + 1]};
+	}
+
+	/**< Hop count from source to every vertex, or unreachable */
+	std::vector<size_type> bfs(vertex source) const {
+		check(source);
+
+		std::vector<size_type> distance(vertices(), unreachable);
+		std::vector<vertex> queue;
+		queue.reserve(vertices());
+		distance[source] = 0;
+		queue.push_back(source);
+		for (size_type head = 0; head < queue.size(); ++head) {
+			const vertex v = queue[head];
+			for (size_type i = _offsets[v]; i < _offsets[v + 1]; ++i) {
+				const vertex u = _targets[i];
+				if (distance[u] == unreachable) {
+					distance[u] = distance[v] + 1;
+					queue.push_back(u);
+				}
+			}
+		}
+		return distance;
+	}
+
+	/**
+	 * Same distances as bfs(), after Beamer et al., "Direction-Optimizing
+	 * Breadth-First Search". While the frontier is small it expands top
+	 * down, claiming unvisited targets with a compare-and-swap. Once its
+	 * edges outnumber a fraction of those left unexplored, it switches to
+	 * bottom up: every unvisited vertex looks for any predecessor in the
+	 * frontier and stops at the first, which skips most edges of the hubs
+	 * of power-law graphs. It goes back top down when the frontier shrinks.
+	 *
+	 * Each level is split among threads in chunks taken from a shared
+	 * counter, so a few huge degrees do not stall one thread.
+	 */
+	std::vector<size_type> parallel_bfs(vertex source, unsigned threads = std::thread::hardware_concurrency()) const {
+		check(source);
+		threads = std::max(threads, 1u);
+
+		const size_type n = vertices();
+		std::unique_ptr<std::atomic<size_type>[]> distance(new std::atomic<size_type>[n]);
+		parallel_for(threads, n, [&](size_type first, size_type last, unsigned) {
+			for (size_type v = first; v < last; ++v)
+				distance[v].store(unreachable, std::memory_order_relaxed);
+		});
+		distance[source].store(0, std::memory_order_relaxed);
+
+		std::vector<level> locals(threads);
+		std::vector<vertex> frontier(1, source);
+		std::vector<std::uint8_t> in_frontier, in_next;
+		size_type frontier_size = 1;
+		size_type frontier_edges = _offsets[source + 1] - _offsets[source];
+		size_type unexplored_edges = edges() - (_in_offsets[source + 1] - _in_offsets[source]);
+		bool bottom_up = false;
+
+		for (size_type depth = 1; frontier_size; ++depth) {
+			if (!bottom_up && frontier_edges > unexplored_edges / top_down_factor) {
+				in_frontier.assign(n, 0);
+				for (auto v : frontier)
+					in_frontier[v] = 1;
+				bottom_up = true;
+			} else if (bottom_up && frontier_size < n / bottom_up_factor) {
+				frontier.clear();
+				for (size_type v = 0; v < n; ++v)
+					if (in_frontier[v])
+						frontier.push_back(v);
+				bottom_up = false;
+			}
+
+			for (auto& local : locals)
+				local = level();
+
+			if (bottom_up) {
+				in_next.assign(n, 0);
+				parallel_for(threads, n, [&](size_type first, size_type last, unsigned t) {
+					level& local = locals[t];
+					for (size_type v = first; v < last; ++v) {
+						if (distance[v].load(std::memory_order_relaxed) != unreachable)
+							continue;
+						for (size_type i = _in_offsets[v]; i < _in_offsets[v + 1]; ++i) {
+							if (in_frontier[_sources[i]]) {
+								distance[v].store(depth, std::memory_order_relaxed);
+								in_next[v] = 1;
+								local.claim(*this, v);
+								break;
+							}
+						}
+					}
+				});
+				in_frontier.swap(in_next);
+			} else {
+				parallel_for(threads, frontier.size(), [&](size_type first, size_type last, unsigned t) {
+					level& local = locals[t];
+					for (size_type j = first; j < last; ++j) {
+						const vertex v = frontier[j];
+						for (size_type i = _offsets[v]; i < _offsets[v + 1]; ++i) {
+							const vertex u = _targets[i];
+							size_type expected = unreachable;
+							if (distance[u].load(std::memory_order_relaxed) == unreachable
+									&& distance[u].compare_exchange_strong(expected, depth, std::memory_order_relaxed)) {
+								local._next.push_back(u);
+								local.claim(*this, u);
+							}
+						}
+					}
+				}, top_down_grain);
+				frontier.clear();
+				for (auto& local : locals)
+					frontier.insert(frontier.end(), local._next.begin(), local._next.end());
+			}
+
+			frontier_size = frontier_edges = 0;
+			for (auto& local : locals) {
+				frontier_size += local._size;
+				frontier_edges += local._edges;
+				unexplored_edges -= local._in_edges;
+			}
+		}
+
+		std::vector<size_type> result(n);
+		for (size_type v = 0; v < n; ++v)
+			result[v] = distance[v].load(std::memory_order_relaxed);
+		return result;
+	}
+
+	/**< Vertices reachable from source in depth-first preorder, following edges in input order */
+	std::vector<vertex> dfs(vertex source) const {
+		check(source);
+
+		std::vector<std::uint8_t> visited(vertices(), 0);
+		std::vector<vertex> order;
+		std::vector<std::pair<vertex, size_type>> stack;
+		visited[source] = 1;
+		order.push_back(source);
+		stack.emplace_back(source, _offsets[source]);
+		while (!stack.empty()) {
+			auto& top = stack.back();
+			if (top.second == _offsets[top.first + 1]) {
+				stack.pop_back();
+				continue;
+			}
+			const vertex u = _targets[top.second++];
+			if (!visited[u]) {
+				visited[u] = 1;
+				order.push_back(u);
+				stack.emplace_back(u, _offsets[u]);
+			}
+		}
+		return order;
+	}
+
+	/**
+	 * Length of the shortest path from source to every vertex, or
+	 * std::numeric_limits<Weight>::max() for those it cannot reach. Throws
+	 * std::invalid_argument on reaching a negative edge.
+	 */
+	std::vector<Weight> dijkstra(vertex source) const {
+		check(source);
+
+		using entry = std::pair<Weight, vertex>;
+		std::vector<Weight> distance(vertices(), std::numeric_limits<Weight>::max());
+		std::priority_queue<entry, std::vector<entry>, std::greater<entry>> queue;
+		distance[source] = Weight();
+		queue.emplace(Weight(), source);
+		while (!queue.empty()) {
+			const entry top = queue.top();
+			queue.pop();
+			const vertex v = top.second;
+			// Vertices are queued again instead of decreasing their keys; the
+			// outdated entries are skipped here.
+			if (distance[v] < top.first)
+				continue;
+			for (size_type i = _offsets[v]; i < _offsets[v + 1]; ++i) {
+				if (_weights[i] < Weight())
+					throw std::invalid_argument("Negative edge weight.");
+				const Weight candidate = top.first + _weights[i];
+				const vertex u = _targets[i];
+				if (candidate < distance[u]) {
+					distance[u] = candidate;
+					queue.emplace(candidate, u);
+				}
+			}
+		}
+		return distance;
+	}
+
+	/**< Every vertex, each before the targets of its edges; throws std::invalid_argument on a cycle */
+	std::vector<vertex> topological_sort() const {
+		const size_type n = vertices();
+		std::vector<size_type> pending(n);
+		std::vector<vertex> order;
+		order.reserve(n);
+		for (size_type v = 0; v < n; ++v) {
+			pending[v] = _in_offsets[v + 1] - _in_offsets[v];
+			if (!pending[v])
+				order.push_back(v);
+		}
+
+		for (size_type head = 0; head < order.size(); ++head) {
+			const vertex v = order[head];
+			for (size_type i = _offsets[v]; i < _offsets[v + 1]; ++i)
+				if (!--pending[_targets[i]])
+					order.push_back(_targets[i]);
+		}
+
+		if (order.size() != n)
+			throw std::invalid_argument("Graph has a cycle.");
+		return order;
+	}
+
+private:
+	/**< Heuristics of the direction-optimizing BFS, as tuned by Beamer et al. */
+	static constexpr size_type top_down_factor = 14;
+	static constexpr size_type bottom_up_factor = 24;
+
+	/**< Work items a thread takes at a time; frontier vertices cost more than unvisited ones */
+	static constexpr size_type grain = 4096;
+	static constexpr size_type top_down_grain = 64;
+
+	/**< What one thread found in a BFS level */
+	struct level {
+		void claim(const csr_graph& graph, vertex v) {
+			++_size;
+			_edges += graph._offsets[v + 1] - graph._offsets[v];
+			_in_edges += graph._in_offsets[v + 1] - graph._in_offsets[v];
+		}
+
+		std::vector<vertex> _next;
+		size_type _size { 0 };
+		size_type _edges { 0 };
+		size_type _in_edges { 0 };
+	};
+
+	template<typename InputIt>
+	void build(size_type vertices, InputIt first, InputIt last) {
+		if (vertices > std::numeric_limits<vertex>::max())
+			throw std::length_error("Too many vertices.");
+
+		_offsets.assign(vertices + 1, 0);
+		_in_offsets.assign(vertices + 1, 0);
+		for (auto it = first; it != last; ++it) {
+			if (it->_from >= vertices || it->_to >= vertices)
+				throw std::out_of_range("Edge endpoint out of range.");
+			++_offsets[it->_from + 1];
+			++_in_offsets[it->_to + 1];
+		}
+		for (size_type v = 0; v < vertices; ++v) {
+			_offsets[v + 1] += _offsets[v];
+			_in_offsets[v + 1] += _in_offsets[v];
+		}
+
+		const size_type edges = _offsets[vertices];
+		_targets.resize(edges);
+		_weights.resize(edges);
+		_sources.resize(edges);
+		std::vector<size_type> out(_offsets.begin(), _offsets.end() - 1);
+		std::vector<size_type> in(_in_offsets.begin(), _in_offsets.end() - 1);
+		for (auto it = first; it != last; ++it) {
+			const size_type i = out[it->_from]++;
+			_targets[i] = it->_to;
+			_weights[i] = it->_weight;
+			_sources[in[it->_to]++] = it->_from;
+		}
+	}
+
+	void check(vertex v) const {
+		if (v >= vertices())
+			throw std::out_of_range("Vertex out of range.");
+	}
+
+	/**
+	 * Calls body(first, last, t) over chunks of 0..n-1 from threads threads,
+	 * t being the calling thread's index; runs inline for a single thread.
+	 */
+	template<typename Body>
+	static void parallel_for(unsigned threads, size_type n, Body body, size_type chunk = grain) {
+		if (threads == 1 || n <= chunk) {
+			body(0, n, 0);
+			return;
+		}
+
+		std::atomic<size_type> next(0);
+		auto work = [&](unsigned t) {
+			for (size_type first; (first = next.fetch_add(chunk)) < n;)
+				body(first, std::min(first + chunk, n), t);
+		};
+		std::vector<std::thread> workers;
+		for (unsigned t = 1; t < threads; ++t)
+			workers.emplace_back(work, t);
+		work(0);
+		for (auto& worker : workers)
+			worker.join();
+	}
+
+	std::vector<size_type> _offsets;
+	std::vector<vertex> _targets;
+	std::vector<Weight> _weights;
+	std::vector<size_type> _in_offsets;
+	std::vector<vertex> _sources;
+};
+
+template<typename Weight>
+constexpr typename csr_graph<Weight>::size_type csr_graph<Weight>::unreachable;
+
+}
+}
+
+#endif /* CSR_GRAPH_H_ */
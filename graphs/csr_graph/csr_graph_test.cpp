@@ -0,0 +1,161 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <vector>
+#include "csr_graph.h"
+
+using data_structures::graphs::csr_graph;
+
+namespace {
+
+using graph = csr_graph<>;
+using edge = graph::edge;
+
+/**< A few vertices with most of the edges, so parallel_bfs goes bottom up */
+std::vector<edge> skewed_edges(std::size_t vertices, std::size_t edges, unsigned seed) {
+	std::mt19937 generator(seed);
+	std::uniform_int_distribution<graph::vertex> any(0, vertices - 1);
+	std::uniform_int_distribution<graph::vertex> hub(0, 7);
+	std::uniform_int_distribution<unsigned> weight(0, 100);
+	std::vector<edge> result;
+	for (std::size_t i = 0; i < edges; ++i) {
+		graph::vertex from = generator() % 2 ? hub(generator) : any(generator);
+		graph::vertex to = generator() % 2 ? hub(generator) : any(generator);
+		result.emplace_back(from, to, weight(generator));
+	}
+	return result;
+}
+
+/**< Whether every edge goes from an earlier to a later vertex of order */
+bool is_topological(const graph& g, const std::vector<graph::vertex>& order) {
+	std::vector<std::size_t> position(g.vertices());
+	for (std::size_t i = 0; i < order.size(); ++i)
+		position[order[i]] = i;
+	for (graph::vertex v = 0; v < g.vertices(); ++v)
+		for (auto u : g.neighbours(v))
+			if (position[v] >= position[u])
+				return false;
+	return order.size() == g.vertices();
+}
+
+}
+
+class csr_graph_test: public testing::Test {
+public:
+	/**< 0 -> 1 -> 3, 0 -> 2 -> 3, 3 -> 4, with 5 isolated */
+	graph g { 6, { { 0, 1, 4 }, { 0, 2, 1 }, { 1, 3, 1 }, { 2, 3, 5 }, { 3, 4, 2 } } };
+};
+
+TEST_F(csr_graph_test, isCreatedEmpty) {
+	graph empty;
+	EXPECT_EQ(0, empty.vertices());
+	EXPECT_EQ(0, empty.edges());
+	EXPECT_THROW(empty.bfs(0), std::out_of_range);
+	EXPECT_TRUE(empty.topological_sort().empty());
+}
+
+TEST_F(csr_graph_test, storesEdgesByVertex) {
+	EXPECT_EQ(6, g.vertices());
+	EXPECT_EQ(5, g.edges());
+	EXPECT_EQ(2, g.degree(0));
+	EXPECT_EQ(0, g.degree(5));
+	EXPECT_EQ(2, g.in_degree(3));
+
+	auto neighbours = g.neighbours(0);
+	ASSERT_EQ(2, neighbours.size());
+	EXPECT_EQ(1, neighbours[0]);
+	EXPECT_EQ(2, neighbours[1]);
+	EXPECT_EQ(4, g.weights(0)[0]);
+	EXPECT_EQ(1, g.weights(0)[1]);
+
+	std::vector<graph::vertex> predecessors(g.predecessors(3).begin(), g.predecessors(3).end());
+	EXPECT_EQ((std::vector<graph::vertex> { 1, 2 }), predecessors);
+	EXPECT_THROW(g.neighbours(6), std::out_of_range);
+}
+
+TEST_F(csr_graph_test, rejectsEdgesOutOfRange) {
+	EXPECT_THROW((graph(2, { { 0, 2 } })), std::out_of_range);
+	EXPECT_THROW((graph(2, { { 2, 0 } })), std::out_of_range);
+}
+
+TEST_F(csr_graph_test, keepsParallelEdgesAndLoops) {
+	graph multi(2, { { 0, 1 }, { 0, 1 }, { 1, 1 } });
+	EXPECT_EQ(2, multi.degree(0));
+	EXPECT_EQ(3, multi.in_degree(1));
+	EXPECT_EQ((std::vector<std::size_t> { 0, 1 }), multi.bfs(0));
+}
+
+TEST_F(csr_graph_test, measuresHopsBreadthFirst) {
+	auto distance = g.bfs(0);
+	EXPECT_EQ((std::vector<std::size_t> { 0, 1, 1, 2, 3, graph::unreachable }), distance);
+
+	distance = g.bfs(3);
+	EXPECT_EQ(graph::unreachable, distance[0]);
+	EXPECT_EQ(1, distance[4]);
+}
+
+TEST_F(csr_graph_test, walksDepthFirstInEdgeOrder) {
+	EXPECT_EQ((std::vector<graph::vertex> { 0, 1, 3, 4, 2 }), g.dfs(0));
+	EXPECT_EQ((std::vector<graph::vertex> { 5 }), g.dfs(5));
+}
+
+TEST_F(csr_graph_test, findsShortestPaths) {
+	auto distance = g.dijkstra(0);
+	EXPECT_EQ(0, distance[0]);
+	EXPECT_EQ(4, distance[1]);
+	EXPECT_EQ(1, distance[2]);
+	EXPECT_EQ(5, distance[3]);
+	EXPECT_EQ(7, distance[4]);
+	EXPECT_EQ(std::numeric_limits<unsigned>::max(), distance[5]);
+
+	csr_graph<int> negative(2, { { 0, 1, -1 } });
+	EXPECT_THROW(negative.dijkstra(0), std::invalid_argument);
+}
+
+TEST_F(csr_graph_test, matchesBellmanFordOnRandomGraphs) {
+	const std::size_t n = 200;
+	const auto edges = skewed_edges(n, 2000, 3);
+	graph random(n, edges);
+
+	const unsigned infinity = std::numeric_limits<unsigned>::max();
+	std::vector<unsigned> expected(n, infinity);
+	expected[0] = 0;
+	for (std::size_t round = 1; round < n; ++round)
+		for (const auto& e : edges)
+			if (expected[e._from] != infinity)
+				expected[e._to] = std::min(expected[e._to], expected[e._from] + e._weight);
+
+	EXPECT_EQ(expected, random.dijkstra(0));
+}
+
+TEST_F(csr_graph_test, sortsTopologically) {
+	auto order = g.topological_sort();
+	EXPECT_TRUE(is_topological(g, order));
+
+	graph cyclic(3, { { 0, 1 }, { 1, 2 }, { 2, 0 } });
+	EXPECT_THROW(cyclic.topological_sort(), std::invalid_argument);
+
+	std::mt19937 generator(5);
+	std::vector<edge> edges;
+	for (int i = 0; i < 5000; ++i) {
+		graph::vertex a = generator() % 1000, b = generator() % 1000;
+		if (a != b)
+			edges.emplace_back(std::min(a, b), std::max(a, b));
+	}
+	graph dag(1000, edges);
+	EXPECT_TRUE(is_topological(dag, dag.topological_sort()));
+}
+
+TEST_F(csr_graph_test, parallelBfsMatchesBfs) {
+	EXPECT_EQ(g.bfs(0), g.parallel_bfs(0, 1));
+
+	for (unsigned seed = 0; seed < 4; ++seed) {
+		graph random(20000, skewed_edges(20000, 100000, seed));
+		for (graph::vertex source : { 0u, 9u, 19999u }) {
+			const auto expected = random.bfs(source);
+			for (unsigned threads : { 1u, 2u, 4u })
+				ASSERT_EQ(expected, random.parallel_bfs(source, threads));
+		}
+	}
+}
@@ -0,0 +1,132 @@
+#ifndef FLAT_HASH_MAP_H_
+#define FLAT_HASH_MAP_H_
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include "hashing/flat_hash_set/flat_hash_set.h"
+
+namespace data_structures {
+namespace hashing {
+
+/**< Returns the key of a key-value pair */
+struct pair_key {
+	template<typename K, typename V>
+	const K& operator()(const std::pair<K, V>& item) const {
+		return item.first;
+	}
+};
+
+/**
+ * Unordered map on a flat_hash_table, storing std::pair<const K, V> items
+ * inline in the slots. Like flat_hash_set, inserting a present key or
+ * removing a missing one throws; operator[] and find() are the lenient
+ * alternatives.
+ */
+template<typename K, typename V, typename Hash = std::hash<K>, typename KeyEqual = std::equal_to<K>,
+		typename Allocator = std::allocator<std::pair<const K, V>>>
+class flat_hash_map: public flat_hash_table<std::pair<const K, V>, K, pair_key, Hash, KeyEqual, Allocator> {
+	using table = flat_hash_table<std::pair<const K, V>, K, pair_key, Hash, KeyEqual, Allocator>;
+	using self = flat_hash_map<K, V, Hash, KeyEqual, Allocator>;
+	using size_type = std::size_t;
+
+public:
+	using key_type = K;
+	using mapped_type = V;
+	using value_type = std::pair<const K, V>;
+
+	flat_hash_map() = default;
+
+	flat_hash_map(const self& other) = default;
+
+	flat_hash_map(self&& other) = default;
+
+	flat_hash_map(std::initializer_list<value_type> items) {
+		this->reserve(items.size());
+		for (const auto& item : items)
+			insert(item.first, item.second);
+	}
+
+	bool has(const K& key) const {
+		return this->find_index(key) != table::npos;
+	}
+
+	void insert(const K& key, V value) {
+		if (!this->find_or_emplace(key, key, std::move(value)).second)
+			// TODO: find a better exception to throw.
+			throw std::exception();
+	}
+
+	V& at(const K& key) {
+		return this->slot(checked_index(key)).second;
+	}
+
+	const V& at(const K& key) const {
+		return this->slot(checked_index(key)).second;
+	}
+
+	/**< The value mapped to key, or nullptr; valid until the next insertion */
+	V* find(const K& key) {
+		size_type index = this->find_index(key);
+		return index == table::npos ? nullptr : &this->slot(index).second;
+	}
+
+	const V* find(const K& key) const {
+		size_type index = this->find_index(key);
+		return index == table::npos ? nullptr : &this->slot(index).second;
+	}
+
+	/**< The value mapped to key, value-initialised first if key is missing */
+	V& operator[](const K& key) {
+		return this->slot(this->find_or_emplace(key, std::piecewise_construct,
+				std::forward_as_tuple(key), std::forward_as_tuple()).first).second;
+	}
+
+	void remove(const K& key) {
+		size_type index = this->find_index(key);
+		if (index == table::npos)
+			throw std::exception();
+		this->erase_index(index);
+	}
+
+	self& operator=(self rhs) {
+		this->swap_table(rhs);
+		return *this;
+	}
+
+	bool operator==(const self& rhs) const {
+		if (this->size() != rhs.size())
+			return false;
+		for (const auto& item : rhs) {
+			const V* value = find(item.first);
+			if (value == nullptr || !(*value == item.second))
+				return false;
+		}
+		return true;
+	}
+
+	bool operator!=(const self& rhs) const {
+		return !(*this == rhs);
+	}
+
+	friend void swap(self& a, self& b) {
+		a.swap_table(b);
+	}
+
+private:
+	size_type checked_index(const K& key) const {
+		size_type index = this->find_index(key);
+		if (index == table::npos)
+			throw std::out_of_range("Key not in map.");
+		return index;
+	}
+};
+
+}
+}
+
+#endif /* FLAT_HASH_MAP_H_ */
@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include "flat_hash_map.h"
+
+using data_structures::hashing::flat_hash_map;
+
+class flat_hash_map_test: public testing::Test {
+public:
+	flat_hash_map<int, std::string> map;
+};
+
+TEST_F(flat_hash_map_test, isCreatedEmpty) {
+	EXPECT_EQ(0, map.size());
+	EXPECT_FALSE(map.has(0));
+	EXPECT_EQ(nullptr, map.find(0));
+	EXPECT_THROW(map.at(0), std::out_of_range);
+	EXPECT_THROW(map.remove(0), std::exception);
+}
+
+TEST_F(flat_hash_map_test, insertsAndLooksUpValues) {
+	for (int i = 0; i < 500; ++i)
+		map.insert(i, std::to_string(i));
+
+	EXPECT_EQ(500, map.size());
+	EXPECT_EQ("42", map.at(42));
+	ASSERT_NE(nullptr, map.find(7));
+	EXPECT_EQ("7", *map.find(7));
+	EXPECT_EQ(nullptr, map.find(500));
+	EXPECT_THROW(map.insert(42, "again"), std::exception);
+	EXPECT_EQ("42", map.at(42));
+}
+
+TEST_F(flat_hash_map_test, subscriptInsertsMissingKeys) {
+	map[1] = "one";
+	map[1] += "!";
+	EXPECT_EQ("one!", map.at(1));
+	EXPECT_EQ("", map[2]);
+	EXPECT_EQ(2, map.size());
+
+	flat_hash_map<std::string, int> counts;
+	for (const char* word : { "a", "b", "a", "c", "a" })
+		++counts[word];
+	EXPECT_EQ(3, counts.at("a"));
+	EXPECT_EQ(1, counts.at("c"));
+}
+
+TEST_F(flat_hash_map_test, removesKeys) {
+	for (int i = 0; i < 100; ++i)
+		map.insert(i, std::to_string(i));
+	for (int i = 0; i < 100; i += 3)
+		map.remove(i);
+
+	for (int i = 0; i < 100; ++i)
+		EXPECT_EQ(i % 3 != 0, map.has(i));
+	EXPECT_THROW(map.remove(0), std::exception);
+}
+
+TEST_F(flat_hash_map_test, iteratesOverMutableValues) {
+	flat_hash_map<int, int> squares { { 1, 1 }, { 2, 4 }, { 3, 9 } };
+	for (auto& item : squares)
+		item.second += item.first;
+
+	EXPECT_EQ(2, squares.at(1));
+	EXPECT_EQ(6, squares.at(2));
+	EXPECT_EQ(12, squares.at(3));
+}
+
+TEST_F(flat_hash_map_test, comparesKeysAndValues) {
+	flat_hash_map<int, int> a { { 1, 1 }, { 2, 2 } };
+	flat_hash_map<int, int> b(a);
+	EXPECT_TRUE(a == b);
+	b[2] = 3;
+	EXPECT_TRUE(a != b);
+	b = a;
+	EXPECT_TRUE(a == b);
+}
+
+TEST_F(flat_hash_map_test, matchesReferenceUnderRandomOperations) {
+	std::mt19937 generator(11);
+	std::uniform_int_distribution<int> keys(0, 1000);
+	flat_hash_map<int, int> values;
+	std::unordered_map<int, int> expected;
+
+	for (int i = 0; i < 50000; ++i) {
+		int key = keys(generator);
+		switch (generator() % 3) {
+		case 0:
+			values[key] += i;
+			expected[key] += i;
+			break;
+		case 1:
+			if (expected.erase(key))
+				values.remove(key);
+			break;
+		default:
+			ASSERT_EQ(expected.count(key) == 1, values.has(key));
+		}
+		ASSERT_EQ(expected.size(), values.size());
+	}
+
+	for (const auto& item : expected)
+		EXPECT_EQ(item.second, values.at(item.first));
+}
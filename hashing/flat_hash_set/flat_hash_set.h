@@ -0,0 +1,526 @@
+#ifndef FLAT_HASH_SET_H_
+#define FLAT_HASH_SET_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace data_structures {
+namespace hashing {
+
+/**
+ * Control bytes of sixteen consecutive slots, matched all at once: with one
+ * SSE2 compare where available, byte by byte otherwise. Each match is a
+ * bitmask with bit i set for slot i of the group.
+ */
+class control_group {
+public:
+	static constexpr std::size_t width = 16;
+
+	/**< A full slot holds the 7 low bits of its hash; these have the high bit set */
+	static constexpr std::int8_t empty = -128;
+	static constexpr std::int8_t deleted = -2;
+
+	explicit control_group(const std::int8_t* ctrl) {
+#if defined(__SSE2__)
+		_ctrl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl));
+#else
+		std::memcpy(_ctrl, ctrl, width);
+#endif
+	}
+
+	std::uint32_t match(std::int8_t h2) const {
+#if defined(__SSE2__)
+		return _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), _ctrl));
+#else
+		std::uint32_t mask = 0;
+		for (std::size_t i = 0; i < width; ++i)
+			mask |= std::uint32_t(_ctrl[i] == h2) << i;
+		return mask;
+#endif
+	}
+
+	std::uint32_t match_empty() const {
+		return match(empty);
+	}
+
+	std::uint32_t match_empty_or_deleted() const {
+#if defined(__SSE2__)
+		return _mm_movemask_epi8(_ctrl);
+#else
+		std::uint32_t mask = 0;
+		for (std::size_t i = 0; i < width; ++i)
+			mask |= std::uint32_t(_ctrl[i] < 0) << i;
+		return mask;
+#endif
+	}
+
+	/**< Index of the lowest bit set in a non-zero mask */
+	static std::size_t lowest(std::uint32_t mask) {
+		return __builtin_ctz(mask);
+	}
+
+private:
+#if defined(__SSE2__)
+	__m128i _ctrl;
+#else
+	std::int8_t _ctrl[width];
+#endif
+};
+
+/**
+ * Open addressing table shared by flat_hash_set and flat_hash_map, after
+ * the SwissTable layout. Items sit in a flat slot array next to one control
+ * byte per slot, which tells empty, deleted and full slots apart and keeps
+ * 7 bits of the full slot's hash. A lookup starts at the group picked by
+ * the rest of the hash, compares the 7 bits across the whole group and
+ * only looks at items whose bits match, so a miss rarely touches items at
+ * all. Groups are probed quadratically and the table grows past 7/8 full.
+ *
+ * KeyOf extracts the key out of a stored Value.
+ */
+template<typename Value, typename Key, typename KeyOf, typename Hash, typename KeyEqual, typename Allocator>
+class flat_hash_table {
+protected:
+	using size_type = std::size_t;
+	using traits = std::allocator_traits<Allocator>;
+	using ctrl_allocator = typename traits::template rebind_alloc<std::int8_t>;
+	using ctrl_traits = std::allocator_traits<ctrl_allocator>;
+	using self = flat_hash_table<Value, Key, KeyOf, Hash, KeyEqual, Allocator>;
+
+	static constexpr size_type npos = size_type(-1);
+	static constexpr size_type width = control_group::width;
+
+	template<typename NodeT>
+	class iterator_base {
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using value_type = typename std::remove_const<NodeT>::type;
+		using difference_type = std::ptrdiff_t;
+		using pointer = NodeT*;
+		using reference = NodeT&;
+
+		iterator_base(const self* table, size_type index) :
+				_table(table), _index(index) {
+			skip();
+		}
+
+		iterator_base& operator++() {
+			if (_index == _table->_capacity)
+				throw std::out_of_range("Iterating beyond table end.");
+			++_index;
+			skip();
+			return *this;
+		}
+
+		iterator_base operator++(int) {
+			iterator_base old = *this;
+			++(*this);
+			return old;
+		}
+
+		bool operator==(const iterator_base& other) const {
+			return _index == other._index;
+		}
+
+		bool operator!=(const iterator_base& other) const {
+			return _index != other._index;
+		}
+
+		NodeT& operator*() const {
+			return _table->_slots[_index];
+		}
+
+		NodeT* operator->() const {
+			return &_table->_slots[_index];
+		}
+
+	private:
+		void skip() {
+			while (_index < _table->_capacity && _table->_ctrl[_index] < 0)
+				++_index;
+		}
+
+		const self* _table;
+		size_type _index;
+	};
+
+public:
+	using hasher = Hash;
+	using key_equal = KeyEqual;
+	using allocator_type = Allocator;
+
+	using iterator = iterator_base<Value>;
+	using const_iterator = iterator_base<const Value>;
+
+	size_type size() const {
+		return _size;
+	}
+
+	/**< Slots allocated, a power of two; up to 7/8 of them fill before the table grows */
+	size_type capacity() const {
+		return _capacity;
+	}
+
+	/**< Grows the table so n items fit without further rehashing */
+	void reserve(size_type n) {
+		if (!n)
+			return;
+		size_type capacity = _capacity ? _capacity : width;
+		while (capacity - capacity / 8 < n)
+			capacity *= 2;
+		if (capacity > _capacity)
+			rehash(capacity);
+	}
+
+	void clear() {
+		destroy_items();
+		if (_capacity)
+			reset_ctrl();
+	}
+
+	iterator begin() {
+		return {this, 0};
+	}
+
+	iterator end() {
+		return {this, _capacity};
+	}
+
+	const_iterator begin() const {
+		return {this, 0};
+	}
+
+	const_iterator end() const {
+		return {this, _capacity};
+	}
+
+protected:
+	flat_hash_table() = default;
+
+	flat_hash_table(const self& other) :
+			_alloc(traits::select_on_container_copy_construction(other._alloc)),
+			_hash(other._hash), _equal(other._equal) {
+		reserve(other._size);
+		for (const auto& item : other)
+			insert_unique(item);
+	}
+
+	flat_hash_table(self&& other) {
+		swap_table(other);
+	}
+
+	~flat_hash_table() {
+		release();
+	}
+
+	/**< Slot holding key, or npos */
+	template<typename K>
+	size_type find_index(const K& key) const {
+		if (!_size)
+			return npos;
+
+		const size_type hash = mix(_hash(key));
+		const std::int8_t h2 = hash & 0x7F;
+		size_type group = (hash >> 7) & _group_mask;
+		for (size_type step = 0;; group = (group + ++step) & _group_mask) {
+			control_group ctrl(_ctrl + group * width);
+			for (std::uint32_t match = ctrl.match(h2); match; match &= match - 1) {
+				size_type index = group * width + control_group::lowest(match);
+				if (_equal(KeyOf()(_slots[index]), key))
+					return index;
+			}
+			if (ctrl.match_empty())
+				return npos;
+		}
+	}
+
+	/**
+	 * Slot holding key, building a Value out of args in a free slot if the
+	 * key is missing. The second member tells whether it was built.
+	 */
+	template<typename K, typename... Args>
+	std::pair<size_type, bool> find_or_emplace(const K& key, Args&&... args) {
+		size_type index = find_index(key);
+		if (index != npos)
+			return {index, false};
+
+		const size_type hash = mix(_hash(key));
+		if (!_growth_left)
+			grow();
+		index = free_slot(hash);
+		traits::construct(_alloc, _slots + index, std::forward<Args>(args)...);
+		occupy(index, hash);
+		return {index, true};
+	}
+
+	void erase_index(size_type index) {
+		traits::destroy(_alloc, _slots + index);
+		--_size;
+
+		// A probe crossing this group stops at an empty slot anyway, so the
+		// hole may only be left empty if the group already has one.
+		size_type group = index / width * width;
+		if (control_group(_ctrl + group).match_empty()) {
+			_ctrl[index] = control_group::empty;
+			++_growth_left;
+		} else {
+			_ctrl[index] = control_group::deleted;
+		}
+	}
+
+	Value& slot(size_type index) {
+		return _slots[index];
+	}
+
+	const Value& slot(size_type index) const {
+		return _slots[index];
+	}
+
+	void insert_unique(const Value& item) {
+		find_or_emplace(KeyOf()(item), item);
+	}
+
+	void swap_table(self& other) {
+		using std::swap;
+
+		swap(_alloc, other._alloc);
+		swap(_hash, other._hash);
+		swap(_equal, other._equal);
+		swap(_ctrl, other._ctrl);
+		swap(_slots, other._slots);
+		swap(_capacity, other._capacity);
+		swap(_group_mask, other._group_mask);
+		swap(_size, other._size);
+		swap(_growth_left, other._growth_left);
+	}
+
+	bool same_items(const self& other) const {
+		if (_size != other._size)
+			return false;
+		for (const auto& item : other)
+			if (find_index(KeyOf()(item)) == npos)
+				return false;
+		return true;
+	}
+
+private:
+	/**< Spreads std::hash values, often the identity, over every bit the table uses */
+	static size_type mix(size_type hash) {
+		std::uint64_t h = hash;
+		h ^= h >> 33;
+		h *= 0xff51afd7ed558ccdULL;
+		h ^= h >> 33;
+		return static_cast<size_type>(h);
+	}
+
+	/**< First empty or deleted slot on the probe sequence of hash */
+	size_type free_slot(size_type hash) const {
+		size_type group = (hash >> 7) & _group_mask;
+		for (size_type step = 0;; group = (group + ++step) & _group_mask) {
+			std::uint32_t match = control_group(_ctrl + group * width).match_empty_or_deleted();
+			if (match)
+				return group * width + control_group::lowest(match);
+		}
+	}
+
+	void occupy(size_type index, size_type hash) {
+		if (_ctrl[index] == control_group::empty)
+			--_growth_left;
+		_ctrl[index] = hash & 0x7F;
+		++_size;
+	}
+
+	/**< Doubles the table, or only sweeps tombstones out when they fill most of it */
+	void grow() {
+		if (_capacity && _size <= _capacity / 2 - _capacity / 16)
+			rehash(_capacity);
+		else
+			rehash(_capacity ? _capacity * 2 : width);
+	}
+
+	/**
+	 * Moves every item into new arrays of capacity slots. Both arrays are
+	 * allocated before the table changes, and an item that throws while
+	 * being copied over puts the old table back, as growing a dynamic_array
+	 * does.
+	 */
+	void rehash(size_type capacity) {
+		ctrl_allocator ctrl_alloc(_alloc);
+		Value* slots = traits::allocate(_alloc, capacity);
+		std::int8_t* ctrl;
+		try {
+			ctrl = ctrl_traits::allocate(ctrl_alloc, capacity);
+		} catch (...) {
+			traits::deallocate(_alloc, slots, capacity);
+			throw;
+		}
+
+		self old;
+		swap_table(old);
+		_alloc = old._alloc;
+		_hash = old._hash;
+		_equal = old._equal;
+		_slots = slots;
+		_ctrl = ctrl;
+		_capacity = capacity;
+		_group_mask = capacity / width - 1;
+		reset_ctrl();
+
+		try {
+			for (size_type i = 0; i < old._capacity; ++i) {
+				if (old._ctrl[i] < 0)
+					continue;
+				const size_type hash = mix(_hash(KeyOf()(old._slots[i])));
+				size_type index = free_slot(hash);
+				traits::construct(_alloc, _slots + index, std::move_if_noexcept(old._slots[i]));
+				occupy(index, hash);
+			}
+		} catch (...) {
+			release();
+			swap_table(old);
+			throw;
+		}
+	}
+
+	void reset_ctrl() {
+		std::memset(_ctrl, control_group::empty, _capacity);
+		_growth_left = _capacity - _capacity / 8;
+	}
+
+	void destroy_items() {
+		for (size_type i = 0; i < _capacity; ++i)
+			if (_ctrl[i] >= 0)
+				traits::destroy(_alloc, _slots + i);
+		_size = 0;
+	}
+
+	void release() {
+		if (!_capacity)
+			return;
+		destroy_items();
+		ctrl_allocator ctrl_alloc(_alloc);
+		ctrl_traits::deallocate(ctrl_alloc, _ctrl, _capacity);
+		traits::deallocate(_alloc, _slots, _capacity);
+		_ctrl = nullptr;
+		_slots = nullptr;
+		_capacity = 0;
+	}
+
+	Allocator _alloc;
+	Hash _hash;
+	KeyEqual _equal;
+	std::int8_t* _ctrl { nullptr };
+	Value* _slots { nullptr };
+	size_type _capacity { 0 };
+	size_type _group_mask { 0 };
+	size_type _size { 0 };
+	size_type _growth_left { 0 };
+};
+
+/**< Returns the item itself, which is its own key */
+struct identity_key {
+	template<typename T>
+	const T& operator()(const T& item) const {
+		return item;
+	}
+};
+
+/**
+ * Unordered set on a flat_hash_table, with the has/insert/remove interface
+ * of the trees: inserting a present item or removing a missing one throws.
+ */
+template<typename T, typename Hash = std::hash<T>, typename KeyEqual = std::equal_to<T>,
+		typename Allocator = std::allocator<T>>
+class flat_hash_set: public flat_hash_table<T, T, identity_key, Hash, KeyEqual, Allocator> {
+	using table = flat_hash_table<T, T, identity_key, Hash, KeyEqual, Allocator>;
+	using self = flat_hash_set<T, Hash, KeyEqual, Allocator>;
+	using size_type = std::size_t;
+
+public:
+	using value_type = T;
+
+	/**< Items are keys, so iteration never hands out mutable ones */
+	using iterator = typename table::const_iterator;
+	using const_iterator = typename table::const_iterator;
+
+	flat_hash_set() = default;
+
+	flat_hash_set(const self& other) = default;
+
+	flat_hash_set(self&& other) = default;
+
+	flat_hash_set(std::initializer_list<T> items) {
+		this->reserve(items.size());
+		for (const auto& item : items)
+			insert(item);
+	}
+
+	bool has(const T& item) const {
+		return this->find_index(item) != table::npos;
+	}
+
+	void insert(const T& item) {
+		emplace(item);
+	}
+
+	void insert(T&& item) {
+		emplace(std::move(item));
+	}
+
+	/**< Builds the item out of args first, since its hash needs it whole */
+	template<typename... Args>
+	void emplace(Args&&... args) {
+		T item(std::forward<Args>(args)...);
+		if (!this->find_or_emplace(item, std::move(item)).second)
+			// TODO: find a better exception to throw.
+			throw std::exception();
+	}
+
+	void remove(const T& item) {
+		size_type index = this->find_index(item);
+		if (index == table::npos)
+			throw std::exception();
+		this->erase_index(index);
+	}
+
+	iterator begin() const {
+		return table::begin();
+	}
+
+	iterator end() const {
+		return table::end();
+	}
+
+	self& operator=(self rhs) {
+		this->swap_table(rhs);
+		return *this;
+	}
+
+	bool operator==(const self& rhs) const {
+		return this->same_items(rhs);
+	}
+
+	bool operator!=(const self& rhs) const {
+		return !(*this == rhs);
+	}
+
+	friend void swap(self& a, self& b) {
+		a.swap_table(b);
+	}
+};
+
+}
+}
+
+#endif /* FLAT_HASH_SET_H_ */
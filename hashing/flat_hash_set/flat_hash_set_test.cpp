@@ -0,0 +1,242 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include <random>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+#include "flat_hash_set.h"
+
+using data_structures::hashing::flat_hash_set;
+
+namespace {
+
+/**< Sends every item to the same group, so lookups must probe past it */
+struct colliding_hash {
+	std::size_t operator()(int) const {
+		return 0;
+	}
+};
+
+/**< Allocator that throws bad_alloc while armed, to fail a growth half way */
+template<typename T>
+struct failing_allocator {
+	using value_type = T;
+
+	failing_allocator() = default;
+
+	template<typename U>
+	failing_allocator(const failing_allocator<U>&) {
+	}
+
+	T* allocate(std::size_t n) {
+		if (armed)
+			throw std::bad_alloc();
+		return std::allocator<T>().allocate(n);
+	}
+
+	void deallocate(T* ptr, std::size_t n) {
+		std::allocator<T>().deallocate(ptr, n);
+	}
+
+	template<typename U>
+	bool operator==(const failing_allocator<U>&) const {
+		return true;
+	}
+
+	template<typename U>
+	bool operator!=(const failing_allocator<U>&) const {
+		return false;
+	}
+
+	static bool armed;
+};
+
+template<typename T>
+bool failing_allocator<T>::armed = false;
+
+}
+
+class flat_hash_set_test: public testing::Test {
+public:
+	flat_hash_set<int> set;
+};
+
+TEST_F(flat_hash_set_test, isCreatedEmpty) {
+	EXPECT_EQ(0, set.size());
+	EXPECT_EQ(0, set.capacity());
+	EXPECT_FALSE(set.has(0));
+	EXPECT_TRUE(set.begin() == set.end());
+	EXPECT_THROW(set.remove(0), std::exception);
+}
+
+TEST_F(flat_hash_set_test, insertsAndFindsItems) {
+	for (int i = 0; i < 1000; ++i)
+		set.insert(i * 7);
+
+	EXPECT_EQ(1000, set.size());
+	for (int i = 0; i < 7000; ++i)
+		EXPECT_EQ(i % 7 == 0, set.has(i));
+	EXPECT_GE(set.capacity() - set.capacity() / 8, set.size());
+}
+
+TEST_F(flat_hash_set_test, rejectsDuplicates) {
+	set.insert(3);
+	EXPECT_THROW(set.insert(3), std::exception);
+	EXPECT_THROW(set.emplace(3), std::exception);
+	EXPECT_EQ(1, set.size());
+}
+
+TEST_F(flat_hash_set_test, removesItems) {
+	for (int i = 0; i < 100; ++i)
+		set.insert(i);
+	for (int i = 0; i < 100; i += 2)
+		set.remove(i);
+
+	EXPECT_EQ(50, set.size());
+	for (int i = 0; i < 100; ++i)
+		EXPECT_EQ(i % 2 == 1, set.has(i));
+	EXPECT_THROW(set.remove(0), std::exception);
+}
+
+TEST_F(flat_hash_set_test, probesPastFullGroups) {
+	flat_hash_set<int, colliding_hash> colliding;
+	for (int i = 0; i < 100; ++i)
+		colliding.insert(i);
+	for (int i = 0; i < 50; ++i)
+		colliding.remove(i);
+
+	EXPECT_EQ(50, colliding.size());
+	for (int i = 0; i < 100; ++i)
+		EXPECT_EQ(i >= 50, colliding.has(i));
+	colliding.insert(0);
+	EXPECT_TRUE(colliding.has(0));
+}
+
+TEST_F(flat_hash_set_test, reusesTombstonesWithoutGrowing) {
+	set.reserve(100);
+	const std::size_t capacity = set.capacity();
+	for (int i = 0; i < 100000; ++i) {
+		set.insert(i);
+		if (i >= 50)
+			set.remove(i - 50);
+	}
+
+	EXPECT_EQ(50, set.size());
+	EXPECT_EQ(capacity, set.capacity());
+}
+
+TEST_F(flat_hash_set_test, reservesCapacity) {
+	set.reserve(1000);
+	const std::size_t capacity = set.capacity();
+	EXPECT_GE(capacity - capacity / 8, 1000);
+	for (int i = 0; i < 1000; ++i)
+		set.insert(i);
+	EXPECT_EQ(capacity, set.capacity());
+}
+
+TEST_F(flat_hash_set_test, iteratesOverEveryItem) {
+	std::unordered_set<int> expected;
+	for (int i = 0; i < 500; ++i) {
+		set.insert(i * 3);
+		expected.insert(i * 3);
+	}
+
+	std::unordered_set<int> seen(set.begin(), set.end());
+	EXPECT_EQ(expected, seen);
+}
+
+TEST_F(flat_hash_set_test, clearsItems) {
+	for (int i = 0; i < 100; ++i)
+		set.insert(i);
+	set.clear();
+
+	EXPECT_EQ(0, set.size());
+	EXPECT_FALSE(set.has(5));
+	set.insert(5);
+	EXPECT_TRUE(set.has(5));
+}
+
+TEST_F(flat_hash_set_test, copiesAndMoves) {
+	for (int i = 0; i < 100; ++i)
+		set.insert(i);
+
+	flat_hash_set<int> copy(set);
+	EXPECT_TRUE(copy == set);
+	copy.remove(0);
+	EXPECT_TRUE(copy != set);
+	EXPECT_TRUE(set.has(0));
+
+	flat_hash_set<int> moved(std::move(copy));
+	EXPECT_EQ(99, moved.size());
+	EXPECT_EQ(0, copy.size());
+
+	copy = set;
+	EXPECT_TRUE(copy == set);
+	swap(copy, moved);
+	EXPECT_EQ(99, copy.size());
+	EXPECT_EQ(100, moved.size());
+}
+
+TEST_F(flat_hash_set_test, holdsOwningItems) {
+	flat_hash_set<std::string> strings { "a", "bb", "ccc" };
+	for (int i = 0; i < 100; ++i)
+		strings.emplace(std::to_string(i) + std::string(20, 'x'));
+	strings.remove("bb");
+
+	EXPECT_EQ(102, strings.size());
+	EXPECT_TRUE(strings.has("a"));
+	EXPECT_FALSE(strings.has("bb"));
+	EXPECT_TRUE(strings.has("42" + std::string(20, 'x')));
+}
+
+TEST_F(flat_hash_set_test, matchesReferenceUnderRandomOperations) {
+	std::mt19937 generator(7);
+	std::uniform_int_distribution<int> keys(0, 2000);
+	std::unordered_set<int> expected;
+
+	for (int i = 0; i < 100000; ++i) {
+		int key = keys(generator);
+		if (generator() % 3) {
+			if (expected.insert(key).second)
+				set.insert(key);
+			else
+				EXPECT_THROW(set.insert(key), std::exception);
+		} else {
+			if (expected.erase(key))
+				set.remove(key);
+			else
+				EXPECT_THROW(set.remove(key), std::exception);
+		}
+		ASSERT_EQ(expected.size(), set.size());
+	}
+
+	for (int key = 0; key <= 2000; ++key)
+		EXPECT_EQ(expected.count(key) == 1, set.has(key));
+}
+
+TEST_F(flat_hash_set_test, failedGrowthKeepsEveryItem) {
+	using failing_set = flat_hash_set<int, std::hash<int>, std::equal_to<int>, failing_allocator<int>>;
+	failing_set items;
+	items.insert(0);
+	const std::size_t capacity = items.capacity();
+
+	// Only the slot array comes from failing_allocator<int>, so the next growth fails allocating it.
+	failing_allocator<int>::armed = true;
+	int inserted = 1;
+	try {
+		for (; inserted < 1000; ++inserted)
+			items.insert(inserted);
+	} catch (const std::bad_alloc&) {
+	}
+	failing_allocator<int>::armed = false;
+
+	ASSERT_LT(inserted, 1000);
+	EXPECT_EQ(capacity, items.capacity());
+	EXPECT_EQ(std::size_t(inserted), items.size());
+	for (int i = 0; i < inserted; ++i)
+		EXPECT_TRUE(items.has(i));
+
+	items.insert(inserted);
+	EXPECT_TRUE(items.has(inserted));
+}
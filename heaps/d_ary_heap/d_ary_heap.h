@@ -0,0 +1,205 @@
+#ifndef D_ARY_HEAP_H_
+#define D_ARY_HEAP_H_
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include "arrays/dynamic_array/dynamic_array.h"
+
+namespace data_structures {
+namespace heaps {
+
+/**
+ * Priority queue as an implicit heap of Arity children per node, stored
+ * level by level in a dynamic_array: the children of position i are at
+ * Arity * i + 1 onwards. top() is the least item under Compare, so the
+ * default is a min-heap, unlike std::priority_queue.
+ *
+ * A wider node halves the depth for every squaring of Arity, so push()
+ * does fewer moves, while pop() compares more children per level; those
+ * children share a cache line, so 4 usually beats a binary heap.
+ */
+template<typename T, std::size_t Arity = 4, typename Compare = std::less<T>, typename Allocator = std::allocator<T>>
+class d_ary_heap {
+	static_assert(Arity >= 2, "A heap node needs at least two children.");
+
+private:
+	using init_list = std::initializer_list<T>;
+	using self = d_ary_heap<T, Arity, Compare, Allocator>;
+	using size_type = std::size_t;
+
+public:
+	using value_type = T;
+	using value_compare = Compare;
+	using allocator_type = Allocator;
+
+	static constexpr size_type arity = Arity;
+
+	d_ary_heap() = default;
+
+	explicit d_ary_heap(const Compare& compare) :
+			_compare(compare) {
+	}
+
+	/**< Builds the heap bottom up in O(n) */
+	template<typename InputIt>
+	d_ary_heap(InputIt first, InputIt last, const Compare& compare = Compare()) :
+			_compare(compare) {
+		for (; first != last; ++first)
+			_items.emplace_back(*first);
+		heapify();
+	}
+
+	d_ary_heap(const init_list& items) :
+			d_ary_heap(items.begin(), items.end()) {
+	}
+
+	/**< Least item */
+	const T& top() const {
+		empty_check();
+
+		return _items[0];
+	}
+
+	size_type size() const {
+		return _items.size();
+	}
+
+	bool empty() const {
+		return !_items.size();
+	}
+
+	void push(const T& item) {
+		emplace(item);
+	}
+
+	void push(T&& item) {
+		emplace(std::move(item));
+	}
+
+	template<typename... Args>
+	void emplace(Args&&... args) {
+		_items.emplace_back(std::forward<Args>(args)...);
+		sift_up(_items.size() - 1);
+	}
+
+	/**< Removes and returns the least item */
+	T pop() {
+		empty_check();
+
+		T item = std::move(_items[0]);
+		T last = _items.pop_back();
+		if (_items.size())
+			refill_top(std::move(last));
+		return item;
+	}
+
+	void reserve(size_type n) {
+		_items.reserve(n);
+	}
+
+	void clear() {
+		_items.clear();
+	}
+
+	friend void swap(self& a, self& b) {
+		using std::swap;
+
+		swap(a._items, b._items);
+		swap(a._compare, b._compare);
+	}
+
+private:
+	void empty_check() const {
+		if (empty())
+			throw std::out_of_range("Empty heap.");
+	}
+
+	/**
+	 * Moves the item at position up to its place. The item is held aside
+	 * and the parents it passes shift down into the hole, one move per
+	 * level instead of a swap.
+	 */
+	void sift_up(size_type position) {
+		T item = std::move(_items[position]);
+		while (position) {
+			size_type parent = (position - 1) / Arity;
+			if (!_compare(item, _items[parent]))
+				break;
+			_items[position] = std::move(_items[parent]);
+			position = parent;
+		}
+		_items[position] = std::move(item);
+	}
+
+	/**< Places item at the hole in position or below it, pulling the least children up */
+	void sift_down(size_type position, T&& item) {
+		const size_type size = _items.size();
+		for (;;) {
+			size_type first = Arity * position + 1;
+			if (first >= size)
+				break;
+
+			size_type least = first;
+			size_type last = first + Arity < size ? first + Arity : size;
+			for (size_type child = first + 1; child < last; ++child)
+				if (_compare(_items[child], _items[least]))
+					least = child;
+
+			if (!_compare(_items[least], item))
+				break;
+			_items[position] = std::move(_items[least]);
+			position = least;
+		}
+		_items[position] = std::move(item);
+	}
+
+	/**
+	 * Fills the hole pop() leaves at the top with last, after Floyd: the
+	 * hole first sinks to a leaf along the least children, without
+	 * comparing them to last, which would end up near the bottom anyway,
+	 * then last rises from there. That saves a comparison per level.
+	 */
+	void refill_top(T&& last) {
+		const size_type size = _items.size();
+		size_type position = 0;
+		for (;;) {
+			size_type first = Arity * position + 1;
+			if (first >= size)
+				break;
+
+			size_type least = first;
+			size_type end = first + Arity < size ? first + Arity : size;
+			for (size_type child = first + 1; child < end; ++child)
+				if (_compare(_items[child], _items[least]))
+					least = child;
+
+			_items[position] = std::move(_items[least]);
+			position = least;
+		}
+		_items[position] = std::move(last);
+		sift_up(position);
+	}
+
+	void heapify() {
+		const size_type size = _items.size();
+		for (size_type position = size > 1 ? (size - 2) / Arity + 1 : 0; position--;) {
+			T item = std::move(_items[position]);
+			sift_down(position, std::move(item));
+		}
+	}
+
+	arrays::dynamic_array<T, Allocator> _items;
+	Compare _compare;
+};
+
+template<typename T, std::size_t Arity, typename Compare, typename Allocator>
+constexpr std::size_t d_ary_heap<T, Arity, Compare, Allocator>::arity;
+
+}
+}
+
+#endif /* D_ARY_HEAP_H_ */
@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <queue>
+#include <random>
+#include <string>
+#include <vector>
+#include "d_ary_heap.h"
+
+using data_structures::heaps::d_ary_heap;
+
+class d_ary_heap_test: public testing::Test {
+public:
+	d_ary_heap<int> heap;
+};
+
+TEST_F(d_ary_heap_test, isCreatedEmpty) {
+	EXPECT_EQ(0, heap.size());
+	EXPECT_TRUE(heap.empty());
+	EXPECT_THROW(heap.top(), std::out_of_range);
+	EXPECT_THROW(heap.pop(), std::out_of_range);
+}
+
+TEST_F(d_ary_heap_test, popsLeastFirst) {
+	for (int item : { 5, 3, 8, 1, 9, 2, 7 })
+		heap.push(item);
+
+	EXPECT_EQ(7, heap.size());
+	EXPECT_EQ(1, heap.top());
+	for (int expected : { 1, 2, 3, 5, 7, 8, 9 })
+		EXPECT_EQ(expected, heap.pop());
+	EXPECT_TRUE(heap.empty());
+}
+
+TEST_F(d_ary_heap_test, keepsDuplicates) {
+	d_ary_heap<int> twos { 2, 1, 2, 1, 2 };
+	for (int expected : { 1, 1, 2, 2, 2 })
+		EXPECT_EQ(expected, twos.pop());
+}
+
+TEST_F(d_ary_heap_test, popsGreatestFirstWithGreater) {
+	d_ary_heap<int, 3, std::greater<int>> max_heap { 4, 9, 1, 7 };
+	for (int expected : { 9, 7, 4, 1 })
+		EXPECT_EQ(expected, max_heap.pop());
+}
+
+TEST_F(d_ary_heap_test, heapifiesRanges) {
+	std::vector<int> items(1000);
+	std::iota(items.begin(), items.end(), 0);
+	std::shuffle(items.begin(), items.end(), std::mt19937(1));
+
+	d_ary_heap<int, 8> wide(items.begin(), items.end());
+	EXPECT_EQ(1000, wide.size());
+	for (int expected = 0; expected < 1000; ++expected)
+		ASSERT_EQ(expected, wide.pop());
+}
+
+TEST_F(d_ary_heap_test, holdsMoveOnlyItems) {
+	struct by_value {
+		bool operator()(const std::unique_ptr<int>& a, const std::unique_ptr<int>& b) const {
+			return *a < *b;
+		}
+	};
+
+	d_ary_heap<std::unique_ptr<int>, 2, by_value> owners;
+	for (int item : { 3, 1, 2 })
+		owners.push(std::unique_ptr<int>(new int(item)));
+	EXPECT_EQ(1, *owners.pop());
+	EXPECT_EQ(2, *owners.pop());
+	EXPECT_EQ(3, *owners.top());
+}
+
+TEST_F(d_ary_heap_test, matchesPriorityQueue) {
+	std::mt19937 generator(3);
+	std::priority_queue<int, std::vector<int>, std::greater<int>> expected;
+	d_ary_heap<int, 2> binary;
+
+	for (int i = 0; i < 50000; ++i) {
+		if (expected.empty() || generator() % 3) {
+			int item = generator() % 1000;
+			expected.push(item);
+			heap.push(item);
+			binary.push(item);
+		} else {
+			ASSERT_EQ(expected.top(), heap.pop());
+			ASSERT_EQ(expected.top(), binary.pop());
+			expected.pop();
+		}
+		ASSERT_EQ(expected.size(), heap.size());
+	}
+}
+
+TEST_F(d_ary_heap_test, copiesAndClears) {
+	d_ary_heap<std::string> words { "pear", "apple", "fig" };
+	d_ary_heap<std::string> copy(words);
+	EXPECT_EQ("apple", copy.pop());
+	EXPECT_EQ(3, words.size());
+
+	words.clear();
+	EXPECT_TRUE(words.empty());
+	swap(words, copy);
+	EXPECT_EQ("fig", words.top());
+	EXPECT_TRUE(copy.empty());
+}
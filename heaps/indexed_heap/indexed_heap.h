@@ -0,0 +1,232 @@
+#ifndef INDEXED_HEAP_H_
+#define INDEXED_HEAP_H_
+
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include "arrays/dynamic_array/dynamic_array.h"
+
+namespace data_structures {
+namespace heaps {
+
+/**
+ * d_ary_heap of small integer keys, e.g. graph vertices, each with a
+ * priority that can change while queued. A table from key to heap position
+ * finds any key in O(1), so decrease_key(), update() and remove() are
+ * O(log n) instead of pushing duplicates and skipping them on pop.
+ *
+ * The table is as long as the largest key pushed, so keys should be dense.
+ */
+template<typename Priority, std::size_t Arity = 4, typename Compare = std::less<Priority>>
+class indexed_heap {
+	static_assert(Arity >= 2, "A heap node needs at least two children.");
+
+private:
+	using self = indexed_heap<Priority, Arity, Compare>;
+	using size_type = std::size_t;
+
+	struct entry {
+		entry(size_type key, Priority&& priority) :
+				_key(key), _priority(std::move(priority)) {
+		}
+
+		size_type _key;
+		Priority _priority;
+	};
+
+	/**< Position of keys not in the heap */
+	static constexpr size_type absent = size_type(-1);
+
+public:
+	using key_type = size_type;
+	using priority_type = Priority;
+
+	indexed_heap() = default;
+
+	explicit indexed_heap(const Compare& compare) :
+			_compare(compare) {
+	}
+
+	/**< Key with the least priority */
+	key_type top() const {
+		empty_check();
+
+		return _entries[0]._key;
+	}
+
+	const Priority& top_priority() const {
+		empty_check();
+
+		return _entries[0]._priority;
+	}
+
+	size_type size() const {
+		return _entries.size();
+	}
+
+	bool empty() const {
+		return !_entries.size();
+	}
+
+	bool has(key_type key) const {
+		return key < _positions.size() && _positions[key] != absent;
+	}
+
+	const Priority& priority(key_type key) const {
+		return _entries[position(key)]._priority;
+	}
+
+	/**< Queues key, which must not be queued yet */
+	void push(key_type key, Priority priority) {
+		if (has(key))
+			throw std::invalid_argument("Key already in heap.");
+
+		if (key >= _positions.size())
+			_positions.resize(key + 1, absent);
+		_entries.emplace_back(key, std::move(priority));
+		_positions[key] = _entries.size() - 1;
+		sift_up(_entries.size() - 1);
+	}
+
+	/**< Removes and returns the key with the least priority */
+	key_type pop() {
+		empty_check();
+
+		key_type key = _entries[0]._key;
+		erase(0);
+		return key;
+	}
+
+	/**< Gives key a priority no greater than its current one, moving it up */
+	void decrease_key(key_type key, Priority priority) {
+		size_type at = position(key);
+		if (_compare(_entries[at]._priority, priority))
+			throw std::invalid_argument("Priority would increase.");
+
+		_entries[at]._priority = std::move(priority);
+		sift_up(at);
+	}
+
+	/**< Gives key any priority, moving it whichever way it has to go */
+	void update(key_type key, Priority priority) {
+		size_type at = position(key);
+		const bool up = _compare(priority, _entries[at]._priority);
+		_entries[at]._priority = std::move(priority);
+		if (up)
+			sift_up(at);
+		else
+			sift_down(at);
+	}
+
+	/**< Queues key with priority, or lowers its priority to it if already queued */
+	void push_or_decrease(key_type key, Priority priority) {
+		if (!has(key))
+			push(key, std::move(priority));
+		else if (_compare(priority, _entries[_positions[key]]._priority))
+			decrease_key(key, std::move(priority));
+	}
+
+	void remove(key_type key) {
+		erase(position(key));
+	}
+
+	/**< Makes room for n queued keys, and for keys below n without resizing the table */
+	void reserve(size_type n) {
+		_entries.reserve(n);
+		_positions.reserve(n);
+	}
+
+	void clear() {
+		_entries.clear();
+		_positions.clear();
+	}
+
+	friend void swap(self& a, self& b) {
+		using std::swap;
+
+		swap(a._entries, b._entries);
+		swap(a._positions, b._positions);
+		swap(a._compare, b._compare);
+	}
+
+private:
+	void empty_check() const {
+		if (empty())
+			throw std::out_of_range("Empty heap.");
+	}
+
+	size_type position(key_type key) const {
+		if (!has(key))
+			throw std::out_of_range("Key not in heap.");
+		return _positions[key];
+	}
+
+	/**< Fills the hole at position with the last entry, which may go either way */
+	void erase(size_type at) {
+		_positions[_entries[at]._key] = absent;
+		entry last = _entries.pop_back();
+		if (at == _entries.size())
+			return;
+
+		const bool up = _compare(last._priority, _entries[at]._priority);
+		place(at, std::move(last));
+		if (up)
+			sift_up(at);
+		else
+			sift_down(at);
+	}
+
+	void place(size_type at, entry&& item) {
+		_positions[item._key] = at;
+		_entries[at] = std::move(item);
+	}
+
+	/**< As in d_ary_heap, moving entries into the hole and keeping positions in step */
+	void sift_up(size_type at) {
+		entry item = std::move(_entries[at]);
+		while (at) {
+			size_type parent = (at - 1) / Arity;
+			if (!_compare(item._priority, _entries[parent]._priority))
+				break;
+			place(at, std::move(_entries[parent]));
+			at = parent;
+		}
+		place(at, std::move(item));
+	}
+
+	void sift_down(size_type at) {
+		const size_type size = _entries.size();
+		entry item = std::move(_entries[at]);
+		for (;;) {
+			size_type first = Arity * at + 1;
+			if (first >= size)
+				break;
+
+			size_type least = first;
+			size_type last = first + Arity < size ? first + Arity : size;
+			for (size_type child = first + 1; child < last; ++child)
+				if (_compare(_entries[child]._priority, _entries[least]._priority))
+					least = child;
+
+			if (!_compare(_entries[least]._priority, item._priority))
+				break;
+			place(at, std::move(_entries[least]));
+			at = least;
+		}
+		place(at, std::move(item));
+	}
+
+	arrays::dynamic_array<entry> _entries;
+	std::vector<size_type> _positions;
+	Compare _compare;
+};
+
+template<typename Priority, std::size_t Arity, typename Compare>
+constexpr std::size_t indexed_heap<Priority, Arity, Compare>::absent;
+
+}
+}
+
+#endif /* INDEXED_HEAP_H_ */
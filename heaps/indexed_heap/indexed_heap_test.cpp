@@ -0,0 +1,117 @@
+#include <gtest/gtest.h>
+#include <limits>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+#include "indexed_heap.h"
+
+using data_structures::heaps::indexed_heap;
+
+class indexed_heap_test: public testing::Test {
+public:
+	indexed_heap<int> heap;
+};
+
+TEST_F(indexed_heap_test, isCreatedEmpty) {
+	EXPECT_TRUE(heap.empty());
+	EXPECT_FALSE(heap.has(0));
+	EXPECT_THROW(heap.top(), std::out_of_range);
+	EXPECT_THROW(heap.pop(), std::out_of_range);
+	EXPECT_THROW(heap.priority(0), std::out_of_range);
+}
+
+TEST_F(indexed_heap_test, popsKeysByPriority) {
+	heap.push(3, 30);
+	heap.push(0, 50);
+	heap.push(7, 10);
+
+	EXPECT_EQ(3, heap.size());
+	EXPECT_TRUE(heap.has(7));
+	EXPECT_FALSE(heap.has(5));
+	EXPECT_EQ(30, heap.priority(3));
+	EXPECT_EQ(7, heap.top());
+	EXPECT_EQ(10, heap.top_priority());
+
+	EXPECT_EQ(7, heap.pop());
+	EXPECT_FALSE(heap.has(7));
+	EXPECT_EQ(3, heap.pop());
+	EXPECT_EQ(0, heap.pop());
+}
+
+TEST_F(indexed_heap_test, rejectsQueuedKeys) {
+	heap.push(1, 10);
+	EXPECT_THROW(heap.push(1, 5), std::invalid_argument);
+}
+
+TEST_F(indexed_heap_test, decreasesKeys) {
+	for (int key = 0; key < 10; ++key)
+		heap.push(key, 100 + key);
+
+	heap.decrease_key(9, 1);
+	EXPECT_EQ(9, heap.top());
+	EXPECT_THROW(heap.decrease_key(9, 2), std::invalid_argument);
+	EXPECT_THROW(heap.decrease_key(10, 2), std::out_of_range);
+
+	heap.push_or_decrease(5, 0);
+	heap.push_or_decrease(9, 50);
+	heap.push_or_decrease(12, 3);
+	EXPECT_EQ(5, heap.pop());
+	EXPECT_EQ(9, heap.pop());
+	EXPECT_EQ(12, heap.pop());
+}
+
+TEST_F(indexed_heap_test, updatesAndRemovesKeys) {
+	for (int key = 0; key < 10; ++key)
+		heap.push(key, key);
+
+	heap.update(0, 100);
+	heap.update(8, -1);
+	heap.remove(4);
+	EXPECT_THROW(heap.remove(4), std::out_of_range);
+
+	std::vector<std::size_t> order;
+	while (!heap.empty())
+		order.push_back(heap.pop());
+	EXPECT_EQ((std::vector<std::size_t> { 8, 1, 2, 3, 5, 6, 7, 9, 0 }), order);
+}
+
+TEST_F(indexed_heap_test, matchesOrderedSetReference) {
+	std::mt19937 generator(9);
+	std::set<std::pair<int, std::size_t>> expected;
+	std::vector<int> priorities(500);
+
+	for (int i = 0; i < 100000; ++i) {
+		std::size_t key = generator() % priorities.size();
+		int priority = generator() % 10000;
+		if (!heap.has(key)) {
+			heap.push(key, priority);
+			expected.emplace(priority, key);
+			priorities[key] = priority;
+		} else {
+			switch (generator() % 4) {
+			case 0:
+				if (priority > priorities[key])
+					priority = priorities[key];
+				heap.decrease_key(key, priority);
+				break;
+			case 1:
+				heap.update(key, priority);
+				break;
+			case 2:
+				heap.remove(key);
+				expected.erase({ priorities[key], key });
+				continue;
+			default:
+				priority = heap.top_priority();
+				ASSERT_EQ(expected.begin()->first, priority);
+				expected.erase({ priority, heap.pop() });
+				continue;
+			}
+			expected.erase({ priorities[key], key });
+			expected.emplace(priority, key);
+			priorities[key] = priority;
+		}
+		ASSERT_EQ(expected.size(), heap.size());
+	}
+}
@@ -0,0 +1,326 @@
+#ifndef PAIRING_HEAP_H_
+#define PAIRING_HEAP_H_
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include "memory/pool_allocator/pool_allocator.h"
+
+namespace data_structures {
+namespace heaps {
+
+/**
+ * Priority queue as a heap-ordered tree of any shape, after Fredman et al.,
+ * "The Pairing Heap: A New Form of Self-Adjusting Heap". top() is the least
+ * item under Compare, as in d_ary_heap.
+ *
+ * push() and meld() only link two roots, O(1); pop() pairs up the children
+ * of the root left to right and folds the pairs right to left, O(log n)
+ * amortized. Each node keeps its first child, next sibling and the node
+ * before it, so decrease_key() cuts a subtree out through its handle and
+ * links it back at the root.
+ */
+template<typename T, typename Compare = std::less<T>, typename Allocator = memory::pool_allocator<T>>
+class pairing_heap {
+private:
+	struct node {
+		template<typename... Args>
+		node(Args&&... args) :
+				_item(std::forward<Args>(args)...) {
+		}
+
+		T _item;
+		node* _child { nullptr };
+		node* _sibling { nullptr };
+		node* _prev { nullptr }; /**< Parent of a first child, left sibling of the others */
+	};
+
+	using init_list = std::initializer_list<T>;
+	using self = pairing_heap<T, Compare, Allocator>;
+	using size_type = std::size_t;
+	using node_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<node>;
+	using node_traits = std::allocator_traits<node_allocator>;
+
+public:
+	using value_type = T;
+	using value_compare = Compare;
+	using allocator_type = Allocator;
+
+	/**< Refers to a pushed item until it is popped or its heap is gone */
+	class handle {
+	public:
+		handle() = default;
+
+		const T& operator*() const {
+			return _ptr->_item;
+		}
+
+		const T* operator->() const {
+			return &_ptr->_item;
+		}
+
+	private:
+		friend class pairing_heap;
+
+		handle(node* ptr) :
+				_ptr(ptr) {
+		}
+
+		node* _ptr { nullptr };
+	};
+
+	pairing_heap() = default;
+
+	explicit pairing_heap(const Compare& compare) :
+			_compare(compare) {
+	}
+
+	pairing_heap(const self& other) :
+			_alloc(node_traits::select_on_container_copy_construction(other._alloc)),
+			_compare(other._compare) {
+		memory::reserve(_alloc, other._size);
+		other.for_each([this](const T& item) {
+			push(item);
+		});
+	}
+
+	pairing_heap(self&& other) {
+		swap(*this, other);
+	}
+
+	pairing_heap(const init_list& items) {
+		for (const T& item : items)
+			push(item);
+	}
+
+	~pairing_heap() {
+		release();
+	}
+
+	/**< Least item */
+	const T& top() const {
+		empty_check();
+
+		return _root->_item;
+	}
+
+	size_type size() const {
+		return _size;
+	}
+
+	bool empty() const {
+		return !_size;
+	}
+
+	handle push(const T& item) {
+		return emplace(item);
+	}
+
+	handle push(T&& item) {
+		return emplace(std::move(item));
+	}
+
+	template<typename... Args>
+	handle emplace(Args&&... args) {
+		node* p = create_node(std::forward<Args>(args)...);
+		_root = _root == nullptr ? p : link(_root, p);
+		++_size;
+		return {p};
+	}
+
+	/**< Removes and returns the least item */
+	T pop() {
+		empty_check();
+
+		node* old = _root;
+		_root = combine(old->_child);
+		T item = std::move(old->_item);
+		destroy_node(old);
+		--_size;
+		return item;
+	}
+
+	/**< Lowers the item behind h to item, which must not compare greater than it */
+	void decrease_key(handle h, T item) {
+		node* p = h._ptr;
+		if (_compare(p->_item, item))
+			throw std::invalid_argument("Priority would increase.");
+
+		p->_item = std::move(item);
+		if (p == _root)
+			return;
+
+		if (p->_prev->_child == p)
+			p->_prev->_child = p->_sibling;
+		else
+			p->_prev->_sibling = p->_sibling;
+		if (p->_sibling != nullptr)
+			p->_sibling->_prev = p->_prev;
+		p->_sibling = p->_prev = nullptr;
+		_root = link(_root, p);
+	}
+
+	/**
+	 * Moves every item of other into this heap, leaving other empty. O(1)
+	 * whenever the node memory can change hands, and then handles into
+	 * other stay valid; otherwise the items are moved one by one.
+	 */
+	void meld(self&& other) {
+		if (this == &other || !other._size)
+			return;
+
+		if (!memory::absorb(_alloc, other._alloc)) {
+			memory::reserve(_alloc, other._size);
+			other.drain([this](T&& item) {
+				push(std::move(item));
+			});
+			return;
+		}
+
+		_root = _root == nullptr ? other._root : link(_root, other._root);
+		_size += other._size;
+		other._root = nullptr;
+		other._size = 0;
+	}
+
+	void clear() {
+		release();
+	}
+
+	self& operator=(self rhs) {
+		swap(*this, rhs);
+		return *this;
+	}
+
+	friend void swap(self& a, self& b) {
+		using std::swap;
+
+		swap(a._alloc, b._alloc);
+		swap(a._compare, b._compare);
+		swap(a._root, b._root);
+		swap(a._size, b._size);
+	}
+
+private:
+	void empty_check() const {
+		if (!_size)
+			throw std::out_of_range("Empty heap.");
+	}
+
+	/**< Makes the greater of two detached roots the first child of the other, returning the new root */
+	node* link(node* a, node* b) {
+		if (_compare(b->_item, a->_item))
+			std::swap(a, b);
+
+		b->_sibling = a->_child;
+		if (a->_child != nullptr)
+			a->_child->_prev = b;
+		b->_prev = a;
+		a->_child = b;
+		return a;
+	}
+
+	/**< Two-pass merge of the sibling list starting at first into one detached root */
+	node* combine(node* first) {
+		// Links pairs left to right, stacking the results through _sibling.
+		node* pairs = nullptr;
+		while (first != nullptr) {
+			node* a = first;
+			node* b = a->_sibling;
+			first = b == nullptr ? nullptr : b->_sibling;
+			a->_sibling = a->_prev = nullptr;
+			if (b != nullptr) {
+				b->_sibling = b->_prev = nullptr;
+				a = link(a, b);
+			}
+			a->_sibling = pairs;
+			pairs = a;
+		}
+
+		node* root = nullptr;
+		while (pairs != nullptr) {
+			node* next = pairs->_sibling;
+			pairs->_sibling = nullptr;
+			root = root == nullptr ? pairs : link(root, pairs);
+			pairs = next;
+		}
+		return root;
+	}
+
+	/**< Calls visit on every item, in no particular order */
+	template<typename Visit>
+	void for_each(Visit visit) const {
+		if (_root == nullptr)
+			return;
+
+		std::vector<const node*> pending(1, _root);
+		while (!pending.empty()) {
+			const node* p = pending.back();
+			pending.pop_back();
+			visit(p->_item);
+			for (const node* child = p->_child; child != nullptr; child = child->_sibling)
+				pending.push_back(child);
+		}
+	}
+
+	/**
+	 * Hands every item to take as an rvalue and destroys its node, leaving
+	 * the heap empty. Children are spliced into the pending sibling list,
+	 * so this needs no memory of its own.
+	 */
+	template<typename Take>
+	void drain(Take take) {
+		node* pending = _root;
+		_root = nullptr;
+		_size = 0;
+		while (pending != nullptr) {
+			node* p = pending;
+			pending = p->_sibling;
+			if (p->_child != nullptr) {
+				node* last = p->_child;
+				while (last->_sibling != nullptr)
+					last = last->_sibling;
+				last->_sibling = pending;
+				pending = p->_child;
+			}
+			take(std::move(p->_item));
+			destroy_node(p);
+		}
+	}
+
+	void release() {
+		drain([](T&&) {
+		});
+	}
+
+	template<typename... Args>
+	node* create_node(Args&&... args) {
+		node* p = node_traits::allocate(_alloc, 1);
+		try {
+			node_traits::construct(_alloc, p, std::forward<Args>(args)...);
+		} catch (...) {
+			node_traits::deallocate(_alloc, p, 1);
+			throw;
+		}
+		return p;
+	}
+
+	void destroy_node(node* p) {
+		node_traits::destroy(_alloc, p);
+		node_traits::deallocate(_alloc, p, 1);
+	}
+
+	node_allocator _alloc;
+	Compare _compare;
+	node* _root { nullptr };
+	size_type _size { 0 };
+};
+
+}
+}
+
+#endif /* PAIRING_HEAP_H_ */
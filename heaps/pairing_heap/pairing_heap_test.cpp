@@ -0,0 +1,138 @@
+#include <gtest/gtest.h>
+#include <functional>
+#include <memory>
+#include <queue>
+#include <random>
+#include <string>
+#include <vector>
+#include "pairing_heap.h"
+
+using data_structures::heaps::pairing_heap;
+
+class pairing_heap_test: public testing::Test {
+public:
+	pairing_heap<int> heap;
+};
+
+TEST_F(pairing_heap_test, isCreatedEmpty) {
+	EXPECT_EQ(0, heap.size());
+	EXPECT_TRUE(heap.empty());
+	EXPECT_THROW(heap.top(), std::out_of_range);
+	EXPECT_THROW(heap.pop(), std::out_of_range);
+}
+
+TEST_F(pairing_heap_test, popsLeastFirst) {
+	for (int item : { 5, 3, 8, 1, 9, 2, 7 })
+		heap.push(item);
+
+	EXPECT_EQ(1, heap.top());
+	for (int expected : { 1, 2, 3, 5, 7, 8, 9 })
+		EXPECT_EQ(expected, heap.pop());
+	EXPECT_TRUE(heap.empty());
+}
+
+TEST_F(pairing_heap_test, decreasesKeysThroughHandles) {
+	std::vector<pairing_heap<int>::handle> handles;
+	for (int item = 10; item < 20; ++item)
+		handles.push_back(heap.push(item));
+	EXPECT_EQ(10, heap.pop());
+
+	heap.decrease_key(handles[7], 5);
+	EXPECT_EQ(5, *handles[7]);
+	EXPECT_EQ(5, heap.top());
+	heap.decrease_key(handles[7], 5);
+	EXPECT_THROW(heap.decrease_key(handles[3], 20), std::invalid_argument);
+	heap.decrease_key(handles[3], 6);
+
+	for (int expected : { 5, 6, 11, 12, 14, 15, 16, 18, 19 })
+		EXPECT_EQ(expected, heap.pop());
+}
+
+TEST_F(pairing_heap_test, meldsHeaps) {
+	pairing_heap<int> odd { 1, 5, 3 };
+	pairing_heap<int> even { 4, 2, 6 };
+	auto two = even.top();
+	odd.meld(std::move(even));
+
+	EXPECT_EQ(6, odd.size());
+	EXPECT_TRUE(even.empty());
+	EXPECT_EQ(2, two);
+	for (int expected = 1; expected <= 6; ++expected)
+		EXPECT_EQ(expected, odd.pop());
+
+	odd.meld(std::move(odd));
+	odd.meld(pairing_heap<int>());
+	EXPECT_TRUE(odd.empty());
+}
+
+TEST_F(pairing_heap_test, meldsKeepingHandles) {
+	pairing_heap<int> other;
+	auto handle = other.push(50);
+	heap.push(10);
+	heap.meld(std::move(other));
+	heap.decrease_key(handle, 1);
+	EXPECT_EQ(1, heap.pop());
+	EXPECT_EQ(10, heap.pop());
+}
+
+TEST_F(pairing_heap_test, meldsAcrossAllocators) {
+	pairing_heap<int, std::less<int>, std::allocator<int>> a { 3, 1 }, b { 2 };
+	a.meld(std::move(b));
+	for (int expected : { 1, 2, 3 })
+		EXPECT_EQ(expected, a.pop());
+}
+
+TEST_F(pairing_heap_test, copiesAndAssigns) {
+	pairing_heap<std::string> words { "pear", "apple", "fig" };
+	pairing_heap<std::string> copy(words);
+	EXPECT_EQ("apple", copy.pop());
+	EXPECT_EQ(3, words.size());
+
+	copy = words;
+	EXPECT_EQ(3, copy.size());
+	words.clear();
+	EXPECT_TRUE(words.empty());
+	EXPECT_EQ("apple", copy.pop());
+	EXPECT_EQ("fig", copy.pop());
+}
+
+TEST_F(pairing_heap_test, holdsMoveOnlyItems) {
+	struct by_value {
+		bool operator()(const std::unique_ptr<int>& a, const std::unique_ptr<int>& b) const {
+			return *a < *b;
+		}
+	};
+
+	pairing_heap<std::unique_ptr<int>, by_value> owners;
+	for (int item : { 3, 1, 2 })
+		owners.push(std::unique_ptr<int>(new int(item)));
+	EXPECT_EQ(1, *owners.pop());
+	EXPECT_EQ(2, *owners.top());
+}
+
+TEST_F(pairing_heap_test, survivesLongChains) {
+	for (int item = 1000000; item > 0; --item)
+		heap.push(item);
+	EXPECT_EQ(1, heap.pop());
+	heap.clear();
+
+	for (int item = 0; item < 1000000; ++item)
+		heap.push(item);
+}
+
+TEST_F(pairing_heap_test, matchesPriorityQueue) {
+	std::mt19937 generator(5);
+	std::priority_queue<int, std::vector<int>, std::greater<int>> expected;
+
+	for (int i = 0; i < 50000; ++i) {
+		if (expected.empty() || generator() % 3) {
+			int item = generator() % 1000;
+			expected.push(item);
+			heap.push(item);
+		} else {
+			ASSERT_EQ(expected.top(), heap.pop());
+			expected.pop();
+		}
+		ASSERT_EQ(expected.size(), heap.size());
+	}
+}
@@ -0,0 +1,193 @@
+#ifndef CONCURRENT_QUEUE_H_
+#define CONCURRENT_QUEUE_H_
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "memory/epoch/epoch.h"
+
+namespace data_structures {
+namespace linked {
+
+/**
+ * Unbounded multi-producer, multi-consumer FIFO queue after Michael and
+ * Scott, "Simple, Fast, and Practical Non-Blocking and Blocking Concurrent
+ * Queue Algorithms". Pushing and popping never take a lock.
+ *
+ * The list always starts with a dummy node, whose successor holds the front
+ * item. Popping makes that successor the new dummy, so items are moved out
+ * as soon as they are popped and the old dummy is retired to an epoch
+ * domain. The allocator must be thread-safe; pool_allocator is not.
+ */
+template<typename T, typename Allocator = std::allocator<T>>
+class concurrent_queue {
+	using size_type = std::size_t;
+
+private:
+	struct node {
+		node() :
+				_next(nullptr) {
+		}
+
+		T* item() {
+			return reinterpret_cast<T*>(&_storage);
+		}
+
+		std::atomic<node*> _next;
+		typename std::aligned_storage<sizeof(T), alignof(T)>::type _storage;
+	};
+
+	/**< Keeps head and tail on cache lines of their own */
+	static constexpr size_type cache_line = 64;
+
+	template<typename... Args>
+	node* create_node(Args&&... args) {
+		node* p = node_traits::allocate(_alloc, 1);
+		node_traits::construct(_alloc, p);
+		try {
+			::new (p->item()) T(std::forward<Args>(args)...);
+		} catch (...) {
+			destroy_node(p);
+			throw;
+		}
+		return p;
+	}
+
+	/**< Releases a node whose item is gone, or the dummy that never had one */
+	void destroy_node(node* p) {
+		node_traits::destroy(_alloc, p);
+		node_traits::deallocate(_alloc, p, 1);
+	}
+
+	static void reclaim(void* p, void* context) {
+		static_cast<concurrent_queue*>(context)->destroy_node(static_cast<node*>(p));
+	}
+
+	using node_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<node>;
+	using node_traits = std::allocator_traits<node_allocator>;
+
+public:
+	using allocator_type = Allocator;
+
+	concurrent_queue() {
+		node* dummy = node_traits::allocate(_alloc, 1);
+		node_traits::construct(_alloc, dummy);
+		_head.store(dummy);
+		_tail.store(dummy);
+	}
+
+	concurrent_queue(const concurrent_queue&) = delete;
+	concurrent_queue& operator=(const concurrent_queue&) = delete;
+
+	/**< Must not race with any other operation */
+	~concurrent_queue() {
+		node* dummy = _head.load();
+		node* current = dummy->_next.load();
+		destroy_node(dummy);
+		while (current != nullptr) {
+			node* old = current;
+			current = current->_next.load();
+			old->item()->~T();
+			destroy_node(old);
+		}
+	}
+
+	/**
+	 * Exact once every operation is done, a recent count while they run:
+	 * items being pushed may already be counted, but never more items than
+	 * were pushed.
+	 */
+	size_type size() const {
+		return _size.load();
+	}
+
+	bool empty() const {
+		auto pinned = _epochs.pin();
+		return _head.load()->_next.load() == nullptr;
+	}
+
+	void push_back(const T& item) {
+		emplace_back(item);
+	}
+
+	void push_back(T&& item) {
+		emplace_back(std::move(item));
+	}
+
+	template<typename... Args>
+	void emplace_back(Args&&... args) {
+		node* fresh = create_node(std::forward<Args>(args)...);
+		// Counted before it can be popped, so the count never drops below zero.
+		++_size;
+		auto pinned = _epochs.pin();
+		while (true) {
+			node* tail = _tail.load();
+			node* next = tail->_next.load();
+			if (tail != _tail.load())
+				continue;
+
+			if (next != nullptr) {
+				// Tail is lagging behind, help it along before trying again.
+				_tail.compare_exchange_weak(tail, next);
+			} else if (tail->_next.compare_exchange_weak(next, fresh)) {
+				// Linked in; swinging tail may fail if someone else already helped.
+				_tail.compare_exchange_strong(tail, fresh);
+				break;
+			}
+		}
+	}
+
+	/**< Moves the front item into item, or returns false if there is none */
+	bool try_pop_front(T& item) {
+		auto pinned = _epochs.pin();
+		while (true) {
+			node* head = _head.load();
+			node* tail = _tail.load();
+			node* next = head->_next.load();
+			if (head != _head.load())
+				continue;
+
+			if (next == nullptr)
+				return false;
+
+			if (head == tail) {
+				_tail.compare_exchange_weak(tail, next);
+			} else if (_head.compare_exchange_weak(head, next)) {
+				// Only the winner touches the item; next is now the dummy.
+				T* front = next->item();
+				item = std::move(*front);
+				front->~T();
+				--_size;
+				pinned.retire(head, reclaim, this);
+				return true;
+			}
+		}
+	}
+
+	T pop_front() {
+		T item;
+		if (!try_pop_front(item))
+			throw std::out_of_range("Empty list.");
+		return item;
+	}
+
+private:
+	// Declared first so retired nodes still have it when the epoch domain goes.
+	node_allocator _alloc;
+	mutable memory::epoch_domain _epochs;
+	std::atomic<size_type> _size { 0 };
+	char _pad0[cache_line];
+	std::atomic<node*> _head;
+	char _pad1[cache_line - sizeof(std::atomic<node*>)];
+	std::atomic<node*> _tail;
+	char _pad2[cache_line - sizeof(std::atomic<node*>)];
+};
+
+}
+}
+
+#endif /* CONCURRENT_QUEUE_H_ */
@@ -0,0 +1,132 @@
+#include <atomic>
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "concurrent_queue.h"
+
+using data_structures::linked::concurrent_queue;
+
+class concurrent_queue_test: public testing::Test {
+public:
+	concurrent_queue<int> queue;
+};
+
+TEST_F(concurrent_queue_test, isCreatedEmpty) {
+	EXPECT_EQ(0, queue.size());
+	EXPECT_TRUE(queue.empty());
+}
+
+TEST_F(concurrent_queue_test, popsInPushOrder) {
+	for (int i = 0; i < 10; ++i)
+		queue.push_back(i);
+	EXPECT_EQ(10, queue.size());
+	for (int i = 0; i < 10; ++i)
+		EXPECT_EQ(i, queue.pop_front());
+	EXPECT_TRUE(queue.empty());
+}
+
+TEST_F(concurrent_queue_test, popFrontOfEmptyQueueThrows) {
+	EXPECT_THROW(queue.pop_front(), std::out_of_range);
+	queue.push_back(42);
+	queue.pop_front();
+	EXPECT_THROW(queue.pop_front(), std::out_of_range);
+}
+
+TEST_F(concurrent_queue_test, tryPopFrontReportsEmptiness) {
+	int item = 0;
+	EXPECT_FALSE(queue.try_pop_front(item));
+	queue.push_back(42);
+	EXPECT_TRUE(queue.try_pop_front(item));
+	EXPECT_EQ(42, item);
+	EXPECT_FALSE(queue.try_pop_front(item));
+}
+
+TEST_F(concurrent_queue_test, movesItemsInAndOut) {
+	concurrent_queue<std::unique_ptr<int>> owners;
+	owners.emplace_back(new int(42));
+	owners.emplace_back(new int(13));
+	EXPECT_EQ(42, *owners.pop_front());
+	// The destructor releases whatever is still queued.
+}
+
+TEST_F(concurrent_queue_test, stressKeepsEveryItemAndPerProducerOrder) {
+	const int producers = 4, consumers = 4, per_producer = 20000;
+	std::atomic<int> consumed { 0 };
+	std::atomic<bool> out_of_order { false };
+	std::vector<std::atomic<int>> seen(producers * per_producer);
+	for (auto& count : seen)
+		count = 0;
+
+	std::vector<std::thread> threads;
+	for (int p = 0; p < producers; ++p)
+		threads.emplace_back([&, p] {
+			for (int i = 0; i < per_producer; ++i)
+				queue.push_back(p * per_producer + i);
+		});
+	for (int c = 0; c < consumers; ++c)
+		threads.emplace_back([&] {
+			std::vector<int> last(producers, -1);
+			int item;
+			while (consumed.load() < producers * per_producer) {
+				if (!queue.try_pop_front(item)) {
+					std::this_thread::yield();
+					continue;
+				}
+				++consumed;
+				++seen[item];
+				// Items of any one producer come out in the order it pushed them.
+				int producer = item / per_producer;
+				if (item <= last[producer])
+					out_of_order = true;
+				last[producer] = item;
+			}
+		});
+	for (auto& thread : threads)
+		thread.join();
+
+	EXPECT_FALSE(out_of_order);
+	EXPECT_TRUE(queue.empty());
+	EXPECT_EQ(0, queue.size());
+	for (auto& count : seen)
+		ASSERT_EQ(1, count.load());
+}
+
+TEST_F(concurrent_queue_test, stressSizeNeverExceedsPushedItems) {
+	const int producers = 2, consumers = 2, per_producer = 20000;
+	const std::size_t total = producers * per_producer;
+	std::atomic<int> consumed { 0 };
+	std::atomic<bool> done { false };
+	std::atomic<bool> overcounted { false };
+
+	std::vector<std::thread> threads;
+	for (int p = 0; p < producers; ++p)
+		threads.emplace_back([&] {
+			for (int i = 0; i < per_producer; ++i)
+				queue.push_back(i);
+		});
+	for (int c = 0; c < consumers; ++c)
+		threads.emplace_back([&] {
+			int item;
+			while (consumed.load() < int(total)) {
+				if (queue.try_pop_front(item))
+					++consumed;
+				// A count that went below zero would wrap around past total.
+				if (queue.size() > total)
+					overcounted = true;
+			}
+		});
+	threads.emplace_back([&] {
+		while (!done.load())
+			if (queue.size() > total)
+				overcounted = true;
+	});
+	for (std::size_t t = 0; t + 1 < threads.size(); ++t)
+		threads[t].join();
+	done = true;
+	threads.back().join();
+
+	EXPECT_FALSE(overcounted);
+	EXPECT_EQ(0, queue.size());
+}
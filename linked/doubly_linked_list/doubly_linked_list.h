@@ -10,21 +10,25 @@
 
 #include <algorithm>
 #include <initializer_list>
+#include <memory>
 #include <stdexcept>
+#include <utility>
 #include "abstract/list.h"
+#include "memory/pool_allocator/pool_allocator.h"
 
 namespace data_structures {
 namespace linked {
 
-using abstract::list;
+using abstract::static_list;
 
-template<typename T>
-class doubly_linked_list: public list<T> {
+template<typename T, typename Allocator = memory::pool_allocator<T>>
+class doubly_linked_list: public static_list<doubly_linked_list<T, Allocator>, T> {
 private:
 	struct node {
 	public:
-		node(node* pred, node* succ, const T& item) :
-				_pred(pred), _succ(succ), _item(item) {
+		template<typename... Args>
+		node(node* pred, node* succ, Args&&... args) :
+				_pred(pred), _succ(succ), _item(std::forward<Args>(args)...) {
 		}
 
 		node* _pred;
@@ -39,8 +43,9 @@ private:
 				_ptr(ptr) {
 		}
 
-		iterator_base operator=(const iterator_base& other) {
-			return {other._ptr};
+		iterator_base& operator=(const iterator_base& other) {
+			_ptr = other._ptr;
+			return *this;
 		}
 
 		iterator_base& operator++() {
@@ -86,20 +91,27 @@ private:
 		}
 
 	private:
+		friend class doubly_linked_list;
+
 		node* _ptr;
 	};
 
 	using init_list = std::initializer_list<T>;
-	using parent = list<T>;
-	using self = doubly_linked_list<T>;
+	using self = doubly_linked_list<T, Allocator>;
+	using parent = static_list<self, T>;
 	using size_type = std::size_t;
+	using node_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<node>;
+	using node_traits = std::allocator_traits<node_allocator>;
 
 public:
+	using allocator_type = Allocator;
+
 	doubly_linked_list() :
 			_front(nullptr), _back(nullptr), _size(0) {
 	}
 
-	doubly_linked_list(const self& other) {
+	doubly_linked_list(const self& other) :
+			_alloc(node_traits::select_on_container_copy_construction(other._alloc)) {
 		for (auto e : other)
 			push_back(e);
 	}
@@ -119,7 +131,7 @@ public:
 		while (_front != nullptr) {
 			old = _front;
 			_front = _front->_succ;
-			delete old;
+			destroy_node(old);
 		}
 	}
 
@@ -182,7 +194,7 @@ public:
 		T value = std::move(p->_item);
 		p->_pred->_succ = p->_succ;
 		p->_succ->_pred = p->_pred;
-		delete p;
+		destroy_node(p);
 
 		--this->_size;
 		return value;
@@ -199,7 +211,7 @@ public:
 		} else {
 			_back->_succ = nullptr;
 		}
-		delete aux;
+		destroy_node(aux);
 
 		--this->_size;
 		return item;
@@ -217,7 +229,7 @@ public:
 		} else {
 			_front->_pred = nullptr;
 		}
-		delete aux;
+		destroy_node(aux);
 
 		--this->_size;
 		return item;
@@ -225,16 +237,42 @@ public:
 
 	/**< Insertion operations */
 	void push(size_type position, const T& item) {
+		emplace(position, item);
+	}
+
+	void push(size_type position, T&& item) {
+		emplace(position, std::move(item));
+	}
+
+	void push_back(const T& item) {
+		emplace_back(item);
+	}
+
+	void push_back(T&& item) {
+		emplace_back(std::move(item));
+	}
+
+	void push_front(const T& item) {
+		emplace_front(item);
+	}
+
+	void push_front(T&& item) {
+		emplace_front(std::move(item));
+	}
+
+	/**< Builds the item in place out of args, inside its node */
+	template<typename... Args>
+	void emplace(size_type position, Args&&... args) {
 		if (position < 0 || position > this->_size)
 			throw std::out_of_range("Out of range access.");
 
 		if (position == 0) {
-			push_front(item);
+			emplace_front(std::forward<Args>(args)...);
 			return;
 		}
 
 		if (position == this->_size) {
-			push_back(item);
+			emplace_back(std::forward<Args>(args)...);
 			return;
 		}
 
@@ -248,24 +286,26 @@ public:
 			for (size_type i = _size - 1; i > position; --i)
 				p = p->_pred;
 		}
-		p->_pred = p->_pred->_succ = new node(p->_pred, p, item);
+		p->_pred = p->_pred->_succ = create_node(p->_pred, p, std::forward<Args>(args)...);
 		++this->_size;
 	}
 
-	void push_back(const T& item) {
+	template<typename... Args>
+	void emplace_back(Args&&... args) {
 		if (!_size) {
-			_front = _back = new node(nullptr, nullptr, item);
+			_front = _back = create_node(nullptr, nullptr, std::forward<Args>(args)...);
 		} else {
-			_back = _back->_succ = new node(_back, nullptr, item);
+			_back = _back->_succ = create_node(_back, nullptr, std::forward<Args>(args)...);
 		}
 		++this->_size;
 	}
 
-	void push_front(const T& item) {
+	template<typename... Args>
+	void emplace_front(Args&&... args) {
 		if (!_size) {
-			_front = _back = new node(nullptr, nullptr, item);
+			_front = _back = create_node(nullptr, nullptr, std::forward<Args>(args)...);
 		} else {
-			_front = _front->_pred = new node(nullptr, _front, item);
+			_front = _front->_pred = create_node(nullptr, _front, std::forward<Args>(args)...);
 		}
 		++this->_size;
 	}
@@ -306,6 +346,113 @@ public:
 		return {nullptr};
 	}
 
+	/**< Builds an item right before position, or at the back for end(), in O(1) */
+	template<typename... Args>
+	iterator emplace(iterator position, Args&&... args) {
+		node* succ = position._ptr;
+		node* p = create_node(succ == nullptr ? _back : succ->_pred, succ, std::forward<Args>(args)...);
+		link(p, p);
+		++this->_size;
+		return {p};
+	}
+
+	iterator insert(iterator position, const T& item) {
+		return emplace(position, item);
+	}
+
+	iterator insert(iterator position, T&& item) {
+		return emplace(position, std::move(item));
+	}
+
+	/**< Destroys the item at position in O(1), returning the one after it */
+	iterator erase(iterator position) {
+		node* p = position._ptr;
+		if (p == nullptr)
+			throw std::out_of_range("Erasing list end.");
+
+		node* succ = p->_succ;
+		unlink(p, p);
+		destroy_node(p);
+		--this->_size;
+		return {succ};
+	}
+
+	/**
+	 * Moves [first, last) of other right before position, which must lie
+	 * outside that range.
+	 *
+	 * Nodes are relinked, never copied. Within a list this is O(1). From
+	 * another list the moved items are counted, once both lists share one
+	 * pool: other's pool is absorbed into ours and other draws from ours
+	 * from then on. Only when the memory cannot change hands are the items
+	 * moved over one by one.
+	 */
+	void splice(iterator position, self& other, iterator first, iterator last) {
+		if (first == last)
+			return;
+
+		if (this != &other && !share_allocator(other)) {
+			while (first != last) {
+				emplace(position, std::move(*first));
+				first = other.erase(first);
+			}
+			return;
+		}
+
+		node* head = first._ptr;
+		node* tail = last._ptr == nullptr ? other._back : last._ptr->_pred;
+		if (this != &other) {
+			size_type count = 1;
+			for (node* p = head; p != tail; p = p->_succ)
+				++count;
+			other._size -= count;
+			this->_size += count;
+		}
+
+		other.unlink(head, tail);
+		head->_pred = position._ptr == nullptr ? _back : position._ptr->_pred;
+		tail->_succ = position._ptr;
+		link(head, tail);
+	}
+
+	/**< Moves the item at it right before position, see splice() above */
+	void splice(iterator position, self& other, iterator it) {
+		if (it._ptr == nullptr)
+			throw std::out_of_range("Splicing list end.");
+
+		if (this == &other && (position == it || position._ptr == it._ptr->_succ))
+			return;
+
+		splice(position, other, it, {it._ptr->_succ});
+	}
+
+	/**
+	 * Moves every item of other right before position, leaving other empty.
+	 * O(1) whenever the node memory can change hands, as in singly_linked_list.
+	 */
+	void splice(iterator position, self&& other) {
+		if (this == &other || !other._size)
+			return;
+
+		if (!memory::absorb(_alloc, other._alloc)) {
+			splice(position, other, other.begin(), other.end());
+			return;
+		}
+
+		other._front->_pred = position._ptr == nullptr ? _back : position._ptr->_pred;
+		other._back->_succ = position._ptr;
+		link(other._front, other._back);
+		this->_size += other._size;
+
+		other._front = other._back = nullptr;
+		other._size = 0;
+	}
+
+	/**< Relinks the item at position as the front in O(1), as an LRU cache touches entries */
+	void move_to_front(iterator position) {
+		splice(begin(), *this, position);
+	}
+
 	self& operator=(self&& rhs) {
 		swap(*this, rhs);
 		return *this;
@@ -344,6 +491,7 @@ public:
 		swap(a._front, b._front);
 		swap(a._back, b._back);
 		swap(a._size, b._size);
+		swap(a._alloc, b._alloc);
 	}
 
 private:
@@ -352,6 +500,58 @@ private:
 			throw std::out_of_range("Empty list.");
 	}
 
+	/**< Makes other release its nodes through our allocator, telling whether it could */
+	bool share_allocator(self& other) {
+		if (_alloc == other._alloc)
+			return true;
+		if (!memory::absorb(_alloc, other._alloc))
+			return false;
+		other._alloc = _alloc;
+		return true;
+	}
+
+	/**< Points the neighbours of the chain first..last, already set in its ends, back at it */
+	void link(node* first, node* last) {
+		if (first->_pred == nullptr)
+			_front = first;
+		else
+			first->_pred->_succ = first;
+		if (last->_succ == nullptr)
+			_back = last;
+		else
+			last->_succ->_pred = last;
+	}
+
+	/**< Closes the gap left by the chain first..last, whose own links are kept */
+	void unlink(node* first, node* last) {
+		if (first->_pred == nullptr)
+			_front = last->_succ;
+		else
+			first->_pred->_succ = last->_succ;
+		if (last->_succ == nullptr)
+			_back = first->_pred;
+		else
+			last->_succ->_pred = first->_pred;
+	}
+
+	template<typename... Args>
+	node* create_node(Args&&... args) {
+		node* p = node_traits::allocate(_alloc, 1);
+		try {
+			node_traits::construct(_alloc, p, std::forward<Args>(args)...);
+		} catch (...) {
+			node_traits::deallocate(_alloc, p, 1);
+			throw;
+		}
+		return p;
+	}
+
+	void destroy_node(node* p) {
+		node_traits::destroy(_alloc, p);
+		node_traits::deallocate(_alloc, p, 1);
+	}
+
+	node_allocator _alloc;
 	node* _front { nullptr };
 	node* _back { nullptr };
 	size_type _size { 0 };
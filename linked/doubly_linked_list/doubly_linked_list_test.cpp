@@ -3,6 +3,85 @@
 
 using data_structures::linked::doubly_linked_list;
 
+namespace {
+
+/**< Counts how often it gets copied and moved */
+struct tracked {
+	tracked(int value = 0) :
+			value(value) {
+	}
+
+	tracked(const tracked& other) :
+			value(other.value) {
+		++copies;
+	}
+
+	tracked(tracked&& other) :
+			value(other.value) {
+		++moves;
+	}
+
+	tracked& operator=(const tracked& other) {
+		value = other.value;
+		++copies;
+		return *this;
+	}
+
+	tracked& operator=(tracked&& other) {
+		value = other.value;
+		++moves;
+		return *this;
+	}
+
+	int value;
+	static int copies;
+	static int moves;
+};
+
+int tracked::copies = 0;
+int tracked::moves = 0;
+
+/**< Stateful allocator whose instances never share memory, unlike pool_allocator */
+template<typename T>
+struct separate_allocator {
+	using value_type = T;
+
+	separate_allocator() :
+			id(++instances) {
+	}
+
+	template<typename U>
+	separate_allocator(const separate_allocator<U>& other) :
+			id(other.id) {
+	}
+
+	T* allocate(std::size_t n) {
+		return std::allocator<T>().allocate(n);
+	}
+
+	void deallocate(T* ptr, std::size_t n) {
+		std::allocator<T>().deallocate(ptr, n);
+	}
+
+	template<typename U>
+	bool operator==(const separate_allocator<U>& other) const {
+		return id == other.id;
+	}
+
+	template<typename U>
+	bool operator!=(const separate_allocator<U>& other) const {
+		return id != other.id;
+	}
+
+	int id;
+	static int instances;
+};
+
+template<typename T>
+int separate_allocator<T>::instances = 0;
+
+}
+
 class doubly_linked_list_test: public testing::Test {
 public:
 	doubly_linked_list<int> list;
@@ -178,3 +257,159 @@ TEST_F(doubly_linked_list_test, backwardIteratorRegress) {
 	--it;
 	EXPECT_EQ(list.rend(), it);
 }
+
+TEST_F(doubly_linked_list_test, worksWithStdAllocator) {
+	doubly_linked_list<int, std::allocator<int>> other;
+	other.push_back(42);
+	other.push_front(13);
+	other.push(1, 1963);
+	EXPECT_EQ(13, other.pop_front());
+	EXPECT_EQ(1963, other.pop_front());
+	EXPECT_EQ(42, other.pop_front());
+	EXPECT_EQ(0, other.size());
+}
+
+TEST_F(doubly_linked_list_test, pushMovesRvalues) {
+	doubly_linked_list<tracked> items;
+	tracked item(42);
+	tracked::copies = tracked::moves = 0;
+
+	items.push_back(std::move(item));
+	items.push_front(std::move(item));
+	items.push(1, std::move(item));
+	EXPECT_EQ(0, tracked::copies);
+	EXPECT_EQ(3, tracked::moves);
+
+	items.push_back(item);
+	EXPECT_EQ(1, tracked::copies);
+}
+
+TEST_F(doubly_linked_list_test, emplaceBuildsInPlace) {
+	doubly_linked_list<tracked> items;
+	tracked::copies = tracked::moves = 0;
+
+	items.emplace_back(2);
+	items.emplace_front(0);
+	items.emplace(1, 1);
+	items.emplace(3, 3);
+	EXPECT_EQ(0, tracked::copies);
+	EXPECT_EQ(0, tracked::moves);
+
+	int expected = 0;
+	for (auto& item : items)
+		EXPECT_EQ(expected++, item.value);
+	EXPECT_EQ(4, expected);
+}
+
+TEST_F(doubly_linked_list_test, insertAndEraseByIterator) {
+	list = { 1, 3 };
+	auto it = list.insert(++list.begin(), 2);
+	EXPECT_EQ(2, *it);
+	list.insert(list.begin(), 0);
+	list.insert(list.end(), 4);
+	EXPECT_TRUE(list == doubly_linked_list<int>({ 0, 1, 2, 3, 4 }));
+
+	it = list.erase(it);
+	EXPECT_EQ(3, *it);
+	EXPECT_TRUE(list.erase(list.rbegin()) == list.end());
+	list.erase(list.begin());
+	EXPECT_TRUE(list == doubly_linked_list<int>({ 1, 3 }));
+	EXPECT_EQ(3, list.back());
+	EXPECT_THROW(list.erase(list.end()), std::out_of_range);
+}
+
+TEST_F(doubly_linked_list_test, eraseWhileIterating) {
+	for (int i = 0; i < 10; ++i)
+		list.push_back(i);
+	for (auto it = list.begin(); it != list.end();) {
+		if (*it % 2)
+			it = list.erase(it);
+		else
+			++it;
+	}
+	EXPECT_TRUE(list == doubly_linked_list<int>({ 0, 2, 4, 6, 8 }));
+}
+
+TEST_F(doubly_linked_list_test, spliceWithinList) {
+	list = { 0, 1, 2, 3, 4, 5 };
+	auto first = ++list.begin();
+	auto last = first;
+	for (int i = 0; i < 3; ++i)
+		++last;
+	list.splice(list.end(), list, first, last);
+	EXPECT_TRUE(list == doubly_linked_list<int>({ 0, 4, 5, 1, 2, 3 }));
+
+	list.splice(list.begin(), list, list.rbegin());
+	EXPECT_TRUE(list == doubly_linked_list<int>({ 3, 0, 4, 5, 1, 2 }));
+	list.splice(list.begin(), list, list.begin());
+	EXPECT_EQ(6, list.size());
+	EXPECT_EQ(3, list.front());
+	EXPECT_EQ(2, list.back());
+}
+
+TEST_F(doubly_linked_list_test, spliceRelinksNodesSharingAnAllocator) {
+	using std_list = doubly_linked_list<int, std::allocator<int>>;
+	std_list a { 0, 1, 2 }, b { 10, 11, 12, 13 };
+	const int* moved = &*++b.begin();
+
+	auto last = b.rbegin();
+	a.splice(++a.begin(), b, ++b.begin(), last);
+	EXPECT_TRUE(a == std_list({ 0, 11, 12, 1, 2 }));
+	EXPECT_TRUE(b == std_list({ 10, 13 }));
+	EXPECT_EQ(moved, &*++a.begin());
+	EXPECT_EQ(10, b.front());
+	EXPECT_EQ(13, b.back());
+
+	a.splice(a.end(), std::move(b));
+	EXPECT_TRUE(a == std_list({ 0, 11, 12, 1, 2, 10, 13 }));
+	EXPECT_EQ(0, b.size());
+}
+
+TEST_F(doubly_linked_list_test, spliceRelinksNodesBetweenSeparatePools) {
+	list = { 0, 1, 2 };
+	doubly_linked_list<int> other { 10, 11, 12 };
+	const int* moved = &*++other.begin();
+	list.splice(list.end(), other, ++other.begin(), other.end());
+	EXPECT_TRUE(list == doubly_linked_list<int>({ 0, 1, 2, 11, 12 }));
+	EXPECT_TRUE(other == doubly_linked_list<int>({ 10 }));
+	EXPECT_EQ(moved, &*--list.rbegin());
+
+	// Both lists draw from one pool now, so other keeps working on its own.
+	other.push_back(13);
+	list.splice(list.begin(), other, other.begin());
+	EXPECT_EQ(10, list.front());
+	EXPECT_EQ(1, other.size());
+	EXPECT_EQ(13, other.pop_front());
+
+	doubly_linked_list<int> whole { 20, 21 };
+	list.splice(list.begin(), std::move(whole));
+	EXPECT_TRUE(list == doubly_linked_list<int>({ 20, 21, 10, 0, 1, 2, 11, 12 }));
+	EXPECT_EQ(0, whole.size());
+}
+
+TEST_F(doubly_linked_list_test, spliceMovesItemsWhenMemoryCannotChangeHands) {
+	using separate_list = doubly_linked_list<int, separate_allocator<int>>;
+	separate_list a { 0, 1 }, b { 10, 11, 12 };
+	a.splice(a.end(), b, ++b.begin(), b.end());
+	EXPECT_TRUE(a == separate_list({ 0, 1, 11, 12 }));
+	EXPECT_TRUE(b == separate_list({ 10 }));
+
+	a.splice(a.begin(), std::move(b));
+	EXPECT_TRUE(a == separate_list({ 10, 0, 1, 11, 12 }));
+	EXPECT_EQ(0, b.size());
+}
+
+TEST_F(doubly_linked_list_test, moveToFrontKeepsTheNode) {
+	list = { 0, 1, 2, 3 };
+	auto it = list.rbegin();
+	const int* node = &*it;
+	list.move_to_front(it);
+	EXPECT_TRUE(list == doubly_linked_list<int>({ 3, 0, 1, 2 }));
+	EXPECT_EQ(node, &*list.begin());
+	EXPECT_EQ(2, list.back());
+
+	list.move_to_front(list.begin());
+	list.move_to_front(++list.begin());
+	EXPECT_TRUE(list == doubly_linked_list<int>({ 0, 3, 1, 2 }));
+	EXPECT_THROW(list.move_to_front(list.end()), std::out_of_range);
+}
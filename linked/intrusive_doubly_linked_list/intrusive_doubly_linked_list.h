@@ -0,0 +1,347 @@
+#ifndef INTRUSIVE_DOUBLY_LINKED_LIST_H_
+#define INTRUSIVE_DOUBLY_LINKED_LIST_H_
+
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+namespace data_structures {
+namespace linked {
+
+/**< Links embedded in T, one pair per intrusive_doubly_linked_list the item may be in at once */
+template<typename T>
+struct list_hook {
+	T* _pred { nullptr };
+	T* _succ { nullptr };
+};
+
+/**
+ * Doubly linked list threaded through a hook embedded in its items, e.g.
+ * intrusive_doubly_linked_list<job, &job::hook>. Items live wherever the
+ * caller keeps them: the list never allocates, copies nor destroys them,
+ * and an item must stay alive and in place while it is linked. Since the
+ * item carries its own links, it can be unlinked in O(1) from a reference.
+ */
+template<typename T, list_hook<T> T::*Hook>
+class intrusive_doubly_linked_list {
+private:
+	template<typename NodeT>
+	class iterator_base {
+	public:
+		using iterator_category = std::bidirectional_iterator_tag;
+		using value_type = T;
+		using difference_type = std::ptrdiff_t;
+		using pointer = NodeT*;
+		using reference = NodeT&;
+
+		iterator_base(NodeT* ptr) :
+				_ptr(ptr) {
+		}
+
+		iterator_base& operator++() {
+			if (_ptr == nullptr)
+				throw std::out_of_range("Iterating beyond list end.");
+			_ptr = (_ptr->*Hook)._succ;
+			return *this;
+		}
+
+		iterator_base operator++(int) {
+			NodeT* old = _ptr;
+			++(*this);
+			return {old};
+		}
+
+		iterator_base& operator--() {
+			if (_ptr == nullptr)
+				throw std::out_of_range("Iterating beyond list begin.");
+			_ptr = (_ptr->*Hook)._pred;
+			return *this;
+		}
+
+		iterator_base operator--(int) {
+			NodeT* old = _ptr;
+			--(*this);
+			return {old};
+		}
+
+		bool operator==(const iterator_base& other) const {
+			return _ptr == other._ptr;
+		}
+
+		bool operator!=(const iterator_base& other) const {
+			return _ptr != other._ptr;
+		}
+
+		NodeT& operator*() const {
+			return *_ptr;
+		}
+
+		NodeT* operator->() const {
+			return _ptr;
+		}
+
+	private:
+		friend class intrusive_doubly_linked_list;
+
+		NodeT* _ptr;
+	};
+
+	using self = intrusive_doubly_linked_list<T, Hook>;
+	using size_type = std::size_t;
+
+public:
+	intrusive_doubly_linked_list() = default;
+
+	intrusive_doubly_linked_list(const self&) = delete;
+
+	intrusive_doubly_linked_list(self&& other) {
+		swap(*this, other);
+	}
+
+	T& at(size_type position) {
+		return *walk(position);
+	}
+
+	const T& at(size_type position) const {
+		return *walk(position);
+	}
+
+	T& back() {
+		empty_check();
+
+		return *_back;
+	}
+
+	const T& back() const {
+		empty_check();
+
+		return *_back;
+	}
+
+	T& front() {
+		empty_check();
+
+		return *_front;
+	}
+
+	const T& front() const {
+		empty_check();
+
+		return *_front;
+	}
+
+	size_type size() const {
+		return _size;
+	}
+
+	/**< Removal operations, returning the unlinked item */
+	T& pop(size_type position) {
+		if (position >= _size)
+			throw std::out_of_range("Empty list.");
+
+		T& item = *walk(position);
+		remove(item);
+		return item;
+	}
+
+	T& pop_back() {
+		empty_check();
+
+		T* item = _back;
+		_back = (item->*Hook)._pred;
+		if (_back == nullptr)
+			_front = nullptr;
+		else
+			(_back->*Hook)._succ = nullptr;
+		(item->*Hook)._pred = nullptr;
+
+		--_size;
+		return *item;
+	}
+
+	T& pop_front() {
+		empty_check();
+
+		T* item = _front;
+		_front = (item->*Hook)._succ;
+		if (_front == nullptr)
+			_back = nullptr;
+		else
+			(_front->*Hook)._pred = nullptr;
+		(item->*Hook)._succ = nullptr;
+
+		--_size;
+		return *item;
+	}
+
+	/**< Unlinks item in O(1); it must be linked into this list */
+	void remove(T& item) {
+		list_hook<T>& hook = item.*Hook;
+		if (hook._pred == nullptr)
+			_front = hook._succ;
+		else
+			(hook._pred->*Hook)._succ = hook._succ;
+		if (hook._succ == nullptr)
+			_back = hook._pred;
+		else
+			(hook._succ->*Hook)._pred = hook._pred;
+		hook._pred = hook._succ = nullptr;
+
+		--_size;
+	}
+
+	/**< Insertion operations, linking item in without copying it */
+	void push(size_type position, T& item) {
+		if (position > _size)
+			throw std::out_of_range("Out of range access.");
+
+		insert({position == _size ? nullptr : walk(position)}, item);
+	}
+
+	void push_back(T& item) {
+		insert(end(), item);
+	}
+
+	void push_front(T& item) {
+		insert(begin(), item);
+	}
+
+	using iterator = iterator_base<T>;
+
+	iterator begin() {
+		return {_front};
+	}
+
+	iterator end() {
+		return {nullptr};
+	}
+
+	iterator rbegin() {
+		return {_back};
+	}
+
+	iterator rend() {
+		return {nullptr};
+	}
+
+	using const_iterator = iterator_base<const T>;
+
+	const_iterator begin() const {
+		return {_front};
+	}
+
+	const_iterator end() const {
+		return {nullptr};
+	}
+
+	const_iterator rbegin() const {
+		return {_back};
+	}
+
+	const_iterator rend() const {
+		return {nullptr};
+	}
+
+	/**< Iterator at a linked item, O(1) */
+	iterator iterator_to(T& item) {
+		return {&item};
+	}
+
+	const_iterator iterator_to(const T& item) const {
+		return {&item};
+	}
+
+	/**< Links item right before position, or at the back for end() */
+	void insert(iterator position, T& item) {
+		list_hook<T>& hook = item.*Hook;
+		hook._succ = position._ptr;
+		hook._pred = position._ptr == nullptr ? _back : (position._ptr->*Hook)._pred;
+		link(&item, &item);
+		++_size;
+	}
+
+	/**< Moves every item of other right before position in O(1), leaving other empty */
+	void splice(iterator position, self&& other) {
+		if (this == &other || !other._size)
+			return;
+
+		(other._front->*Hook)._pred = position._ptr == nullptr ? _back : (position._ptr->*Hook)._pred;
+		(other._back->*Hook)._succ = position._ptr;
+		link(other._front, other._back);
+		_size += other._size;
+
+		other._front = other._back = nullptr;
+		other._size = 0;
+	}
+
+	/**< Concatenates other at the end of this list, see splice() */
+	void append(self&& other) {
+		splice(end(), std::move(other));
+	}
+
+	/**< Forgets every item in O(1); their hooks are left as they are */
+	void clear() {
+		_front = _back = nullptr;
+		_size = 0;
+	}
+
+	self& operator=(self&& rhs) {
+		swap(*this, rhs);
+		return *this;
+	}
+
+	friend void swap(self& a, self& b) {
+		using std::swap;
+
+		swap(a._front, b._front);
+		swap(a._back, b._back);
+		swap(a._size, b._size);
+	}
+
+private:
+	void empty_check() const {
+		if (!_size)
+			throw std::out_of_range("Empty list.");
+	}
+
+	T* walk(size_type position) const {
+		if (position >= _size)
+			throw std::out_of_range("Out of range access.");
+
+		T* p;
+		if (position < (_size >> 1)) {
+			p = _front;
+			for (size_type i = 0; i < position; ++i)
+				p = (p->*Hook)._succ;
+		} else {
+			p = _back;
+			for (size_type i = _size - 1; i > position; --i)
+				p = (p->*Hook)._pred;
+		}
+		return p;
+	}
+
+	/**< Points the neighbours of the chain first..last, already set in its ends, back at it */
+	void link(T* first, T* last) {
+		T* pred = (first->*Hook)._pred;
+		T* succ = (last->*Hook)._succ;
+		if (pred == nullptr)
+			_front = first;
+		else
+			(pred->*Hook)._succ = first;
+		if (succ == nullptr)
+			_back = last;
+		else
+			(succ->*Hook)._pred = last;
+	}
+
+	T* _front { nullptr };
+	T* _back { nullptr };
+	size_type _size { 0 };
+};
+
+}
+}
+
+#endif /* INTRUSIVE_DOUBLY_LINKED_LIST_H_ */
@@ -0,0 +1,174 @@
+#include <gtest/gtest.h>
+#include <list>
+#include <random>
+#include <vector>
+#include "intrusive_doubly_linked_list.h"
+
+using data_structures::linked::intrusive_doubly_linked_list;
+using data_structures::linked::list_hook;
+
+/**< Items that can be queued in two lists at once, one per hook */
+struct job {
+	job(int id) :
+			id(id) {
+	}
+
+	int id;
+	list_hook<job> hook;
+	list_hook<job> other_hook;
+};
+
+using job_list = intrusive_doubly_linked_list<job, &job::hook>;
+using other_job_list = intrusive_doubly_linked_list<job, &job::other_hook>;
+
+class intrusive_doubly_linked_list_test: public testing::Test {
+public:
+	intrusive_doubly_linked_list_test() {
+		for (int i = 0; i < 10; ++i)
+			jobs.emplace_back(i);
+	}
+
+	std::vector<int> ids(const job_list& from) {
+		std::vector<int> result;
+		for (const auto& item : from)
+			result.push_back(item.id);
+		return result;
+	}
+
+	std::vector<job> jobs;
+	job_list list;
+};
+
+TEST_F(intrusive_doubly_linked_list_test, isCreatedEmpty) {
+	EXPECT_EQ(0, list.size());
+	EXPECT_TRUE(list.begin() == list.end());
+	EXPECT_THROW(list.front(), std::out_of_range);
+	EXPECT_THROW(list.back(), std::out_of_range);
+	EXPECT_THROW(list.pop_front(), std::out_of_range);
+	EXPECT_THROW(list.pop_back(), std::out_of_range);
+}
+
+TEST_F(intrusive_doubly_linked_list_test, linksItemsInPlace) {
+	list.push_back(jobs[1]);
+	list.push_front(jobs[0]);
+	list.push_back(jobs[2]);
+	EXPECT_EQ(3, list.size());
+	EXPECT_EQ(&jobs[0], &list.front());
+	EXPECT_EQ(&jobs[2], &list.back());
+	EXPECT_EQ(&jobs[1], &list.at(1));
+	EXPECT_THROW(list.at(3), std::out_of_range);
+}
+
+TEST_F(intrusive_doubly_linked_list_test, popsFromBothEnds) {
+	for (auto& item : jobs)
+		list.push_back(item);
+	EXPECT_EQ(&jobs[0], &list.pop_front());
+	EXPECT_EQ(&jobs[9], &list.pop_back());
+	EXPECT_EQ(&jobs[5], &list.pop(4));
+	EXPECT_EQ((std::vector<int> { 1, 2, 3, 4, 6, 7, 8 }), ids(list));
+	EXPECT_TRUE(jobs[0].hook._pred == nullptr && jobs[0].hook._succ == nullptr);
+}
+
+TEST_F(intrusive_doubly_linked_list_test, removesByReference) {
+	for (auto& item : jobs)
+		list.push_back(item);
+	list.remove(jobs[0]);
+	list.remove(jobs[9]);
+	list.remove(jobs[4]);
+	EXPECT_EQ((std::vector<int> { 1, 2, 3, 5, 6, 7, 8 }), ids(list));
+	EXPECT_EQ(7, list.size());
+
+	list.push_back(jobs[4]);
+	EXPECT_EQ(4, list.back().id);
+}
+
+TEST_F(intrusive_doubly_linked_list_test, insertsByPositionAndIterator) {
+	list.push(0, jobs[1]);
+	list.push(0, jobs[0]);
+	list.push(2, jobs[3]);
+	list.push(2, jobs[2]);
+	EXPECT_THROW(list.push(5, jobs[4]), std::out_of_range);
+	list.insert(list.iterator_to(jobs[3]), jobs[9]);
+	list.insert(list.end(), jobs[8]);
+	EXPECT_EQ((std::vector<int> { 0, 1, 2, 9, 3, 8 }), ids(list));
+}
+
+TEST_F(intrusive_doubly_linked_list_test, itemsJoinOneListPerHook) {
+	other_job_list other;
+	for (auto& item : jobs) {
+		list.push_back(item);
+		other.push_front(item);
+	}
+	list.remove(jobs[3]);
+	EXPECT_EQ(9, list.size());
+	EXPECT_EQ(10, other.size());
+	EXPECT_EQ(9, other.front().id);
+	EXPECT_EQ(3, other.at(6).id);
+}
+
+TEST_F(intrusive_doubly_linked_list_test, spliceRelinksEveryItem) {
+	job_list other;
+	for (int i = 0; i < 5; ++i) {
+		list.push_back(jobs[i]);
+		other.push_back(jobs[i + 5]);
+	}
+	list.splice(list.iterator_to(jobs[2]), std::move(other));
+	EXPECT_EQ(0, other.size());
+	EXPECT_EQ((std::vector<int> { 0, 1, 5, 6, 7, 8, 9, 2, 3, 4 }), ids(list));
+
+	other.append(std::move(list));
+	EXPECT_EQ(10, other.size());
+	EXPECT_EQ(0, other.front().id);
+	EXPECT_EQ(4, other.back().id);
+}
+
+TEST_F(intrusive_doubly_linked_list_test, iteratesBothWays) {
+	for (auto& item : jobs)
+		list.push_back(item);
+
+	int expected = 0;
+	for (auto it = list.begin(); it != list.end(); ++it)
+		EXPECT_EQ(expected++, it->id);
+	for (auto it = list.rbegin(); it != list.rend(); --it)
+		EXPECT_EQ(--expected, it->id);
+	EXPECT_EQ(0, expected);
+}
+
+TEST_F(intrusive_doubly_linked_list_test, randomOperationsMatchStdList) {
+	std::vector<job> pool;
+	for (int i = 0; i < 1000; ++i)
+		pool.emplace_back(i);
+	std::vector<bool> linked(pool.size());
+	std::list<int> reference;
+
+	std::mt19937 random(42);
+	for (int i = 0; i < 20000; ++i) {
+		auto& item = pool[random() % pool.size()];
+		if (linked[item.id]) {
+			list.remove(item);
+			reference.remove(item.id);
+		} else if (random() % 2) {
+			list.push_front(item);
+			reference.push_front(item.id);
+		} else {
+			list.push_back(item);
+			reference.push_back(item.id);
+		}
+		linked[item.id] = !linked[item.id];
+		ASSERT_EQ(reference.size(), list.size());
+	}
+	EXPECT_EQ(std::vector<int>(reference.begin(), reference.end()), ids(list));
+}
+
+TEST_F(intrusive_doubly_linked_list_test, moveTransfersItems) {
+	for (auto& item : jobs)
+		list.push_back(item);
+	job_list moved(std::move(list));
+	EXPECT_EQ(0, list.size());
+	EXPECT_EQ(10, moved.size());
+
+	list = std::move(moved);
+	EXPECT_EQ(10, list.size());
+	list.clear();
+	EXPECT_TRUE(list.begin() == list.end());
+}
@@ -0,0 +1,329 @@
+#ifndef INTRUSIVE_SINGLY_LINKED_LIST_H_
+#define INTRUSIVE_SINGLY_LINKED_LIST_H_
+
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+namespace data_structures {
+namespace linked {
+
+/**< Link embedded in T, one per intrusive_singly_linked_list the item may be in at once */
+template<typename T>
+struct forward_list_hook {
+	T* _succ { nullptr };
+};
+
+/**
+ * Singly linked list threaded through a hook embedded in its items, e.g.
+ * intrusive_singly_linked_list<job, &job::hook>. Items live wherever the
+ * caller keeps them: the list never allocates, copies nor destroys them,
+ * and an item must stay alive and in place while it is linked.
+ */
+template<typename T, forward_list_hook<T> T::*Hook>
+class intrusive_singly_linked_list {
+private:
+	template<typename NodeT>
+	class iterator_base {
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using value_type = T;
+		using difference_type = std::ptrdiff_t;
+		using pointer = NodeT*;
+		using reference = NodeT&;
+
+		iterator_base(NodeT* ptr) :
+				_ptr(ptr) {
+		}
+
+		iterator_base& operator++() {
+			if (!_ptr)
+				throw std::out_of_range("Iterating beyond list end.");
+			_ptr = (_ptr->*Hook)._succ;
+			return *this;
+		}
+
+		iterator_base operator++(int) {
+			NodeT* old = _ptr;
+			++(*this);
+			return {old};
+		}
+
+		bool operator==(const iterator_base& other) const {
+			return _ptr == other._ptr;
+		}
+
+		bool operator!=(const iterator_base& other) const {
+			return _ptr != other._ptr;
+		}
+
+		NodeT& operator*() const {
+			return *_ptr;
+		}
+
+		NodeT* operator->() const {
+			return _ptr;
+		}
+
+	private:
+		friend class intrusive_singly_linked_list;
+
+		NodeT* _ptr;
+	};
+
+	using self = intrusive_singly_linked_list<T, Hook>;
+	using size_type = std::size_t;
+
+public:
+	intrusive_singly_linked_list() = default;
+
+	intrusive_singly_linked_list(const self&) = delete;
+
+	intrusive_singly_linked_list(self&& other) {
+		swap(*this, other);
+	}
+
+	T& at(size_type position) {
+		return *walk(position);
+	}
+
+	const T& at(size_type position) const {
+		return *walk(position);
+	}
+
+	T& back() {
+		empty_check();
+
+		return *_back;
+	}
+
+	const T& back() const {
+		empty_check();
+
+		return *_back;
+	}
+
+	T& front() {
+		empty_check();
+
+		return *_front;
+	}
+
+	const T& front() const {
+		empty_check();
+
+		return *_front;
+	}
+
+	size_type size() const {
+		return _size;
+	}
+
+	/**< Removal operations, returning the unlinked item */
+	T& pop(size_type position) {
+		if (position >= _size)
+			throw std::out_of_range("Empty list.");
+
+		if (position == 0)
+			return pop_front();
+
+		return unlink_after(walk(position - 1));
+	}
+
+	/**< Still O(n): the tail has no link back to its predecessor */
+	T& pop_back() {
+		empty_check();
+
+		return pop(_size - 1);
+	}
+
+	T& pop_front() {
+		empty_check();
+
+		T* item = _front;
+		_front = next(item);
+		if (_front == nullptr)
+			_back = nullptr;
+		next(item) = nullptr;
+
+		--_size;
+		return *item;
+	}
+
+	/**< Unlinks item wherever it is, O(n) to find its predecessor */
+	void remove(T& item) {
+		if (_front == &item) {
+			pop_front();
+			return;
+		}
+
+		for (T* p = _front; p != nullptr; p = next(p)) {
+			if (next(p) == &item) {
+				unlink_after(p);
+				return;
+			}
+		}
+		throw std::out_of_range("Item not in list.");
+	}
+
+	/**< Insertion operations, linking item in without copying it */
+	void push(size_type position, T& item) {
+		if (position > _size)
+			throw std::out_of_range("Out of range access.");
+
+		if (position == 0)
+			push_front(item);
+		else
+			insert_after({walk(position - 1)}, item);
+	}
+
+	void push_back(T& item) {
+		next(item) = nullptr;
+		if (!_size)
+			_front = &item;
+		else
+			next(_back) = &item;
+		_back = &item;
+		++_size;
+	}
+
+	void push_front(T& item) {
+		next(item) = _front;
+		_front = &item;
+		if (_back == nullptr)
+			_back = _front;
+		++_size;
+	}
+
+	using iterator = iterator_base<T>;
+
+	iterator begin() {
+		return {_front};
+	}
+
+	iterator end() {
+		return {nullptr};
+	}
+
+	using const_iterator = iterator_base<const T>;
+
+	const_iterator begin() const {
+		return {_front};
+	}
+
+	const_iterator end() const {
+		return {nullptr};
+	}
+
+	void insert_after(iterator position, T& item) {
+		if (position._ptr == nullptr)
+			throw std::out_of_range("Inserting after list end.");
+
+		next(item) = next(position._ptr);
+		next(position._ptr) = &item;
+		if (position._ptr == _back)
+			_back = &item;
+		++_size;
+	}
+
+	/**< Unlinks the item following position and returns it */
+	T& erase_after(iterator position) {
+		if (position._ptr == nullptr || position._ptr == _back)
+			throw std::out_of_range("Erasing after list end.");
+
+		return unlink_after(position._ptr);
+	}
+
+	/**< Moves every item of other right after position in O(1), leaving other empty */
+	void splice_after(iterator position, self&& other) {
+		if (position._ptr == nullptr)
+			throw std::out_of_range("Splicing after list end.");
+
+		if (this == &other || !other._size)
+			return;
+
+		next(other._back) = next(position._ptr);
+		next(position._ptr) = other._front;
+		if (position._ptr == _back)
+			_back = other._back;
+		_size += other._size;
+
+		other._front = other._back = nullptr;
+		other._size = 0;
+	}
+
+	/**< Concatenates other at the end of this list, see splice_after() */
+	void append(self&& other) {
+		if (this == &other || !other._size)
+			return;
+
+		if (!_size)
+			swap(*this, other);
+		else
+			splice_after({_back}, std::move(other));
+	}
+
+	/**< Forgets every item in O(1); their hooks are left as they are */
+	void clear() {
+		_front = _back = nullptr;
+		_size = 0;
+	}
+
+	self& operator=(self&& rhs) {
+		swap(*this, rhs);
+		return *this;
+	}
+
+	friend void swap(self& a, self& b) {
+		using std::swap;
+
+		swap(a._front, b._front);
+		swap(a._back, b._back);
+		swap(a._size, b._size);
+	}
+
+private:
+	static T*& next(T* item) {
+		return (item->*Hook)._succ;
+	}
+
+	static T*& next(T& item) {
+		return (item.*Hook)._succ;
+	}
+
+	void empty_check() const {
+		if (!_size)
+			throw std::out_of_range("Empty list.");
+	}
+
+	T* walk(size_type position) const {
+		if (position >= _size)
+			throw std::out_of_range("Out of range access.");
+
+		T* p = _front;
+		for (size_type i = 0; i < position; ++i)
+			p = next(p);
+		return p;
+	}
+
+	T& unlink_after(T* p) {
+		T* item = next(p);
+		next(p) = next(item);
+		if (item == _back)
+			_back = p;
+		next(item) = nullptr;
+
+		--_size;
+		return *item;
+	}
+
+	T* _front { nullptr };
+	T* _back { nullptr };
+	size_type _size { 0 };
+};
+
+}
+}
+
+#endif /* INTRUSIVE_SINGLY_LINKED_LIST_H_ */
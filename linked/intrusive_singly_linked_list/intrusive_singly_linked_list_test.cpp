@@ -0,0 +1,131 @@
+#include <gtest/gtest.h>
+#include <vector>
+#include "intrusive_singly_linked_list.h"
+
+using data_structures::linked::forward_list_hook;
+using data_structures::linked::intrusive_singly_linked_list;
+
+/**< Items that can be queued in two lists at once, one per hook */
+struct task {
+	task(int id) :
+			id(id) {
+	}
+
+	int id;
+	forward_list_hook<task> hook;
+	forward_list_hook<task> other_hook;
+};
+
+using task_list = intrusive_singly_linked_list<task, &task::hook>;
+using other_task_list = intrusive_singly_linked_list<task, &task::other_hook>;
+
+class intrusive_singly_linked_list_test: public testing::Test {
+public:
+	intrusive_singly_linked_list_test() {
+		for (int i = 0; i < 10; ++i)
+			tasks.emplace_back(i);
+	}
+
+	std::vector<int> ids(const task_list& from) {
+		std::vector<int> result;
+		for (const auto& item : from)
+			result.push_back(item.id);
+		return result;
+	}
+
+	std::vector<task> tasks;
+	task_list list;
+};
+
+TEST_F(intrusive_singly_linked_list_test, isCreatedEmpty) {
+	EXPECT_EQ(0, list.size());
+	EXPECT_TRUE(list.begin() == list.end());
+	EXPECT_THROW(list.front(), std::out_of_range);
+	EXPECT_THROW(list.back(), std::out_of_range);
+	EXPECT_THROW(list.pop_front(), std::out_of_range);
+}
+
+TEST_F(intrusive_singly_linked_list_test, linksItemsInPlace) {
+	list.push_back(tasks[1]);
+	list.push_front(tasks[0]);
+	list.push_back(tasks[3]);
+	list.push(2, tasks[2]);
+	EXPECT_EQ(4, list.size());
+	EXPECT_EQ(&tasks[0], &list.front());
+	EXPECT_EQ(&tasks[3], &list.back());
+	EXPECT_EQ(&tasks[2], &list.at(2));
+	EXPECT_THROW(list.at(4), std::out_of_range);
+	EXPECT_THROW(list.push(6, tasks[4]), std::out_of_range);
+}
+
+TEST_F(intrusive_singly_linked_list_test, popsAndRemoves) {
+	for (auto& item : tasks)
+		list.push_back(item);
+	EXPECT_EQ(&tasks[0], &list.pop_front());
+	EXPECT_EQ(&tasks[9], &list.pop_back());
+	EXPECT_EQ(&tasks[4], &list.pop(3));
+	list.remove(tasks[1]);
+	list.remove(tasks[8]);
+	EXPECT_THROW(list.remove(tasks[0]), std::out_of_range);
+	EXPECT_EQ((std::vector<int> { 2, 3, 5, 6, 7 }), ids(list));
+	EXPECT_EQ(7, list.back().id);
+
+	list.push_back(tasks[8]);
+	EXPECT_EQ(8, list.back().id);
+}
+
+TEST_F(intrusive_singly_linked_list_test, insertsAndErasesAfterIterators) {
+	list.push_back(tasks[0]);
+	list.insert_after(list.begin(), tasks[2]);
+	list.insert_after(list.begin(), tasks[1]);
+	EXPECT_EQ(&tasks[1], &list.erase_after(list.begin()));
+	EXPECT_THROW(list.erase_after(++list.begin()), std::out_of_range);
+	EXPECT_THROW(list.insert_after(list.end(), tasks[3]), std::out_of_range);
+	EXPECT_EQ((std::vector<int> { 0, 2 }), ids(list));
+	EXPECT_EQ(2, list.back().id);
+}
+
+TEST_F(intrusive_singly_linked_list_test, itemsJoinOneListPerHook) {
+	other_task_list other;
+	for (auto& item : tasks) {
+		list.push_back(item);
+		other.push_front(item);
+	}
+	list.pop_front();
+	EXPECT_EQ(9, list.size());
+	EXPECT_EQ(10, other.size());
+	EXPECT_EQ(0, other.back().id);
+}
+
+TEST_F(intrusive_singly_linked_list_test, spliceRelinksEveryItem) {
+	task_list other;
+	for (int i = 0; i < 5; ++i) {
+		list.push_back(tasks[i]);
+		other.push_back(tasks[i + 5]);
+	}
+	list.splice_after(list.begin(), std::move(other));
+	EXPECT_EQ(0, other.size());
+	EXPECT_EQ((std::vector<int> { 0, 5, 6, 7, 8, 9, 1, 2, 3, 4 }), ids(list));
+
+	other.append(std::move(list));
+	EXPECT_EQ(10, other.size());
+	EXPECT_EQ(4, other.back().id);
+	task_list third;
+	third.push_back(other.pop_front());
+	third.append(std::move(other));
+	EXPECT_EQ(10, third.size());
+	EXPECT_EQ(4, third.back().id);
+}
+
+TEST_F(intrusive_singly_linked_list_test, moveTransfersItems) {
+	for (auto& item : tasks)
+		list.push_back(item);
+	task_list moved(std::move(list));
+	EXPECT_EQ(0, list.size());
+	EXPECT_EQ(10, moved.size());
+
+	list = std::move(moved);
+	EXPECT_EQ(10, list.size());
+	list.clear();
+	EXPECT_TRUE(list.begin() == list.end());
+}
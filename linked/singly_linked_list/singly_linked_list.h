@@ -2,21 +2,25 @@
 #define SINGLY_LINKED_LIST_H_
 
 #include <algorithm>
+#include <memory>
 #include <stdexcept>
+#include <utility>
 #include "abstract/list.h"
+#include "memory/pool_allocator/pool_allocator.h"
 
 namespace data_structures {
 namespace linked {
 
-using abstract::list;
+using abstract::static_list;
 
-template<typename T>
-class singly_linked_list: public list<T> {
+template<typename T, typename Allocator = memory::pool_allocator<T>>
+class singly_linked_list: public static_list<singly_linked_list<T, Allocator>, T> {
 private:
 	struct node {
 	public:
-		node(node* succ, const T& item) :
-				_succ(succ), _item(item) {
+		template<typename... Args>
+		node(node* succ, Args&&... args) :
+				_succ(succ), _item(std::forward<Args>(args)...) {
 		}
 
 		node* _succ;
@@ -64,19 +68,26 @@ private:
 		}
 
 	private:
+		friend class singly_linked_list;
+
 		node* _ptr;
 	};
 
-	using parent = list<T>;
-	using self = singly_linked_list<T>;
+	using self = singly_linked_list<T, Allocator>;
+	using parent = static_list<self, T>;
 	using size_type = std::size_t;
+	using node_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<node>;
+	using node_traits = std::allocator_traits<node_allocator>;
 
 public:
+	using allocator_type = Allocator;
+
 	singly_linked_list() :
 			_front(), _size() {
 	}
 
-	singly_linked_list(const self& other) {
+	singly_linked_list(const self& other) :
+			_alloc(node_traits::select_on_container_copy_construction(other._alloc)) {
 		for (auto e : other)
 			push_back(e);
 	}
@@ -86,7 +97,7 @@ public:
 		while (_front) {
 			old = _front;
 			_front = _front->_succ;
-			delete old;
+			destroy_node(old);
 		}
 	}
 
@@ -103,10 +114,7 @@ public:
 	T back() const {
 		empty_check();
 
-		node* p = _front;
-		while (p->_succ != 0)
-			p = p->_succ;
-		return p->_item;
+		return _back->_item;
 	}
 
 	T front() const {
@@ -133,15 +141,20 @@ public:
 
 		/**< Hold node, advance it and then delete the old one */
 		node* aux = p->_succ;
-		T value(aux->_item);
+		T value = std::move(aux->_item);
 		p->_succ = aux->_succ;
-		delete aux;
+		if (aux == _back)
+			_back = p;
+		destroy_node(aux);
 
 		--this->_size;
 		return value;
 	}
 
+	/**< Still O(n): the tail has no link back to its predecessor */
 	T pop_back() {
+		empty_check();
+
 		return pop(this->_size - 1);
 	}
 
@@ -150,9 +163,11 @@ public:
 
 		/**< Hold head, advance it and then delete the old one */
 		node* aux = _front;
-		T value(aux->_item);
+		T value = std::move(aux->_item);
 		_front = aux->_succ;
-		delete aux;
+		if (_front == nullptr)
+			_back = nullptr;
+		destroy_node(aux);
 
 		--this->_size;
 		return value;
@@ -160,27 +175,68 @@ public:
 
 	/**< Insertion operations */
 	void push(size_type position, const T& item) {
+		emplace(position, item);
+	}
+
+	void push(size_type position, T&& item) {
+		emplace(position, std::move(item));
+	}
+
+	void push_back(const T& value) {
+		emplace_back(value);
+	}
+
+	void push_back(T&& value) {
+		emplace_back(std::move(value));
+	}
+
+	void push_front(const T& value) {
+		emplace_front(value);
+	}
+
+	void push_front(T&& value) {
+		emplace_front(std::move(value));
+	}
+
+	/**< Builds the item in place out of args, inside its node */
+	template<typename... Args>
+	void emplace(size_type position, Args&&... args) {
 		if (position < 0 || position > this->_size)
 			throw std::out_of_range("Out of range access.");
 
 		if (position == 0) {
-			push_front(item);
+			emplace_front(std::forward<Args>(args)...);
+			return;
+		}
+
+		if (position == this->_size) {
+			emplace_back(std::forward<Args>(args)...);
 			return;
 		}
 
 		node* p = _front;
 		for (size_type i = 1; i < position; ++i)
 			p = p->_succ;
-		p->_succ = new node(p->_succ, item);
+		p->_succ = create_node(p->_succ, std::forward<Args>(args)...);
 		++this->_size;
 	}
 
-	void push_back(const T& value) {
-		push(this->_size, value);
+	template<typename... Args>
+	void emplace_back(Args&&... args) {
+		node* p = create_node(nullptr, std::forward<Args>(args)...);
+		if (!_size) {
+			_front = _back = p;
+		} else {
+			_back = _back->_succ = p;
+		}
+		++this->_size;
 	}
 
-	void push_front(const T& value) {
-		_front = new node(_front, value);
+	template<typename... Args>
+	void emplace_front(Args&&... args) {
+		_front = create_node(_front, std::forward<Args>(args)...);
+		if (_back == nullptr)
+			_back = _front;
 		++this->_size;
 	}
 
@@ -204,6 +260,60 @@ public:
 		return {nullptr};
 	}
 
+	/**
+	 * Moves every node of other right after position, leaving other empty.
+	 *
+	 * Nodes are relinked, never copied, so this is O(1) whenever the node
+	 * memory can change hands: both lists share an allocator, or other owns
+	 * its pool alone and that pool is absorbed into ours. Otherwise the items
+	 * are moved over one by one.
+	 */
+	void splice_after(iterator position, self&& other) {
+		if (position._ptr == nullptr)
+			throw std::out_of_range("Splicing after list end.");
+
+		if (this == &other || !other._size)
+			return;
+
+		if (!memory::absorb(_alloc, other._alloc)) {
+			node* p = position._ptr;
+			while (other._size) {
+				p = p->_succ = create_node(p->_succ, other.pop_front());
+				if (p->_succ == nullptr)
+					_back = p;
+				++this->_size;
+			}
+			return;
+		}
+
+		other._back->_succ = position._ptr->_succ;
+		position._ptr->_succ = other._front;
+		if (position._ptr == _back)
+			_back = other._back;
+		_size += other._size;
+
+		other._front = other._back = nullptr;
+		other._size = 0;
+	}
+
+	/**< Concatenates other at the end of this list, see splice_after() */
+	void append(self&& other) {
+		if (this == &other || !other._size)
+			return;
+
+		if (!_size) {
+			if (memory::absorb(_alloc, other._alloc)) {
+				std::swap(_front, other._front);
+				std::swap(_back, other._back);
+				std::swap(_size, other._size);
+				return;
+			}
+			push_back(other.pop_front());
+		}
+
+		splice_after({_back}, std::move(other));
+	}
+
 	self& operator=(self&& rhs) {
 		swap(*this, rhs);
 		return *this;
@@ -228,7 +338,9 @@ public:
 		using std::swap;
 
 		swap(a._front, b._front);
+		swap(a._back, b._back);
 		swap(a._size, b._size);
+		swap(a._alloc, b._alloc);
 	}
 
 private:
@@ -237,7 +349,26 @@ private:
 			throw std::out_of_range("Empty list.");
 	}
 
+	template<typename... Args>
+	node* create_node(Args&&... args) {
+		node* p = node_traits::allocate(_alloc, 1);
+		try {
+			node_traits::construct(_alloc, p, std::forward<Args>(args)...);
+		} catch (...) {
+			node_traits::deallocate(_alloc, p, 1);
+			throw;
+		}
+		return p;
+	}
+
+	void destroy_node(node* p) {
+		node_traits::destroy(_alloc, p);
+		node_traits::deallocate(_alloc, p, 1);
+	}
+
+	node_allocator _alloc;
 	node* _front { nullptr };
+	node* _back { nullptr };
 	size_type _size { 0 };
 
 };
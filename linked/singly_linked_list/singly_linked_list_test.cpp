@@ -10,6 +10,46 @@
 
 using data_structures::linked::singly_linked_list;
 
+namespace {
+
+/**< Counts how often it gets copied and moved */
+struct tracked {
+	tracked(int value = 0) :
+			value(value) {
+	}
+
+	tracked(const tracked& other) :
+			value(other.value) {
+		++copies;
+	}
+
+	tracked(tracked&& other) :
+			value(other.value) {
+		++moves;
+	}
+
+	tracked& operator=(const tracked& other) {
+		value = other.value;
+		++copies;
+		return *this;
+	}
+
+	tracked& operator=(tracked&& other) {
+		value = other.value;
+		++moves;
+		return *this;
+	}
+
+	int value;
+	static int copies;
+	static int moves;
+};
+
+int tracked::copies = 0;
+int tracked::moves = 0;
+
+}
+
 class singly_linked_list_test: public testing::Test {
 public:
 	singly_linked_list<int> list;
@@ -134,3 +174,119 @@ TEST_F(singly_linked_list_test, forwardIteratorAdvance) {
 	++it;
 	EXPECT_EQ(list.end(), it);
 }
+
+TEST_F(singly_linked_list_test, worksWithStdAllocator) {
+	singly_linked_list<int, std::allocator<int>> other;
+	other.push_back(42);
+	other.push_front(13);
+	other.push(1, 1963);
+	EXPECT_EQ(13, other.pop_front());
+	EXPECT_EQ(1963, other.pop_front());
+	EXPECT_EQ(42, other.pop_front());
+	EXPECT_EQ(0, other.size());
+}
+
+TEST_F(singly_linked_list_test, backFollowsTail) {
+	list.push_front(42);
+	EXPECT_EQ(42, list.back());
+	list.push_back(1963);
+	EXPECT_EQ(1963, list.back());
+	list.push(2, 13);
+	EXPECT_EQ(13, list.back());
+	EXPECT_EQ(13, list.pop_back());
+	EXPECT_EQ(1963, list.back());
+	EXPECT_EQ(1963, list.pop(1));
+	EXPECT_EQ(42, list.back());
+	EXPECT_EQ(42, list.pop_front());
+	list.push_back(7);
+	EXPECT_EQ(7, list.front());
+	EXPECT_EQ(7, list.back());
+}
+
+TEST_F(singly_linked_list_test, spliceAfterRelinksNodes) {
+	list.push_back(42);
+	list.push_back(13);
+
+	auto other = singly_linked_list<int> { };
+	other.push_back(1963);
+	other.push_back(7);
+
+	list.splice_after(list.begin(), std::move(other));
+	EXPECT_EQ(0, other.size());
+	EXPECT_EQ(4, list.size());
+	EXPECT_EQ(42, list.at(0));
+	EXPECT_EQ(1963, list.at(1));
+	EXPECT_EQ(7, list.at(2));
+	EXPECT_EQ(13, list.at(3));
+	EXPECT_EQ(13, list.back());
+
+	other.push_back(99);
+	EXPECT_EQ(99, other.front());
+}
+
+TEST_F(singly_linked_list_test, spliceAfterEndThrows) {
+	auto other = singly_linked_list<int> { };
+	other.push_back(42);
+	EXPECT_THROW(list.splice_after(list.end(), std::move(other)), std::out_of_range);
+}
+
+TEST_F(singly_linked_list_test, appendConcatenates) {
+	auto other = singly_linked_list<int> { };
+	other.push_back(42);
+	list.append(std::move(other));
+	EXPECT_EQ(1, list.size());
+	EXPECT_EQ(42, list.back());
+
+	other.push_back(1963);
+	other.push_back(13);
+	list.append(std::move(other));
+	EXPECT_EQ(3, list.size());
+	EXPECT_EQ(0, other.size());
+	EXPECT_EQ(42, list.pop_front());
+	EXPECT_EQ(1963, list.pop_front());
+	EXPECT_EQ(13, list.pop_front());
+}
+
+TEST_F(singly_linked_list_test, pushMovesRvalues) {
+	singly_linked_list<tracked> items;
+	tracked item(42);
+	tracked::copies = tracked::moves = 0;
+
+	items.push_back(std::move(item));
+	items.push_front(std::move(item));
+	items.push(1, std::move(item));
+	EXPECT_EQ(0, tracked::copies);
+	EXPECT_EQ(3, tracked::moves);
+
+	items.push_back(item);
+	EXPECT_EQ(1, tracked::copies);
+}
+
+TEST_F(singly_linked_list_test, emplaceBuildsInPlace) {
+	singly_linked_list<tracked> items;
+	tracked::copies = tracked::moves = 0;
+
+	items.emplace_back(2);
+	items.emplace_front(0);
+	items.emplace(1, 1);
+	items.emplace(3, 3);
+	EXPECT_EQ(0, tracked::copies);
+	EXPECT_EQ(0, tracked::moves);
+
+	int expected = 0;
+	for (auto& item : items)
+		EXPECT_EQ(expected++, item.value);
+	EXPECT_EQ(4, expected);
+}
+
+TEST_F(singly_linked_list_test, popMovesItems) {
+	singly_linked_list<tracked> items;
+	for (int i = 0; i < 4; ++i)
+		items.emplace_back(i);
+	tracked::copies = tracked::moves = 0;
+
+	EXPECT_EQ(0, items.pop_front().value);
+	EXPECT_EQ(2, items.pop(1).value);
+	EXPECT_EQ(3, items.pop_back().value);
+	EXPECT_EQ(0, tracked::copies);
+}
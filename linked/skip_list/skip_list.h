@@ -0,0 +1,629 @@
+#ifndef SKIP_LIST_H_
+#define SKIP_LIST_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "abstract/list.h"
+#include "abstract/tree.h"
+#include "linked/doubly_linked_list/doubly_linked_list.h"
+#include "memory/pool_allocator/pool_allocator.h"
+
+namespace data_structures {
+namespace linked {
+
+using abstract::static_list;
+using abstract::static_tree;
+
+/**
+ * Towers, spans and pools shared by both skip lists.
+ *
+ * Every node is a tower of links, one per level it takes part in, with a
+ * height drawn at random so each level holds a quarter of the one below.
+ * Each link also records its span, how many bottom level steps it jumps,
+ * which is what turns a position into an O(log n) walk. Links out of the
+ * last tower of a level span up to a virtual tail one past the last item.
+ *
+ * Towers are variable sized, so rather than one pool per item type there
+ * is one memory_pool per height, created the first time a tower of that
+ * height is needed.
+ */
+template<typename T>
+class skip_list_base {
+protected:
+	using size_type = std::size_t;
+
+	/**< Enough for 4^32 items */
+	static constexpr size_type max_height = 32;
+
+	struct node;
+
+	struct link {
+		node* _next;
+		size_type _span;
+	};
+
+	struct node {
+		T* item() {
+			return reinterpret_cast<T*>(&_storage);
+		}
+
+		typename std::aligned_storage<sizeof(T), alignof(T)>::type _storage;
+		size_type _height;
+		link _links[1];
+	};
+
+	template<typename NodeT>
+	class iterator_base {
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using value_type = typename std::remove_const<NodeT>::type;
+		using difference_type = std::ptrdiff_t;
+		using pointer = NodeT*;
+		using reference = NodeT&;
+
+		iterator_base(node* ptr) :
+				_ptr(ptr) {
+		}
+
+		iterator_base& operator++() {
+			if (_ptr == nullptr)
+				throw std::out_of_range("Iterating beyond list end.");
+			_ptr = _ptr->_links[0]._next;
+			return *this;
+		}
+
+		iterator_base operator++(int) {
+			iterator_base old = *this;
+			++(*this);
+			return old;
+		}
+
+		bool operator==(const iterator_base& other) const {
+			return _ptr == other._ptr;
+		}
+
+		bool operator!=(const iterator_base& other) const {
+			return _ptr != other._ptr;
+		}
+
+		NodeT& operator*() const {
+			return *_ptr->item();
+		}
+
+		NodeT* operator->() const {
+			return _ptr->item();
+		}
+
+	private:
+		node* _ptr;
+	};
+
+	skip_list_base() {
+		// Built in the body, as the pools are only ready once every member is.
+		_head = tower(max_height);
+	}
+
+	skip_list_base(const skip_list_base&) = delete;
+
+	~skip_list_base() {
+		clear();
+		release(_head);
+	}
+
+	void clear() {
+		node* p = _head->_links[0]._next;
+		while (p != nullptr) {
+			node* old = p;
+			p = p->_links[0]._next;
+			destroy_node(old);
+		}
+		for (size_type i = 0; i < max_height; ++i)
+			_head->_links[i] = { nullptr, 1 };
+		_height = 1;
+		_size = 0;
+	}
+
+	/**< Node at position, counting from zero */
+	node* find(size_type position) const {
+		node* p = _head;
+		size_type index = 0;
+		++position;
+		for (size_type level = _height; level-- > 0;) {
+			while (p->_links[level]._next != nullptr && index + p->_links[level]._span <= position) {
+				index += p->_links[level]._span;
+				p = p->_links[level]._next;
+			}
+			if (index == position)
+				break;
+		}
+		return p;
+	}
+
+	/**
+	 * Fills update with the last node before position on every level, and
+	 * index with how far each of those is from the head.
+	 */
+	void trace(size_type position, node** update, size_type* index) const {
+		node* p = _head;
+		size_type at = 0;
+		size_type level = _height;
+		do {
+			--level;
+			while (p->_links[level]._next != nullptr && at + p->_links[level]._span <= position) {
+				at += p->_links[level]._span;
+				p = p->_links[level]._next;
+			}
+			update[level] = p;
+			index[level] = at;
+		} while (level > 0);
+	}
+
+	/**< Links fresh in at position, after the nodes trace() found for it */
+	void link_in(node* fresh, size_type position, node** update, size_type* index) {
+		for (; _height < fresh->_height; ++_height) {
+			update[_height] = _head;
+			index[_height] = 0;
+			_head->_links[_height]._span = _size + 1;
+		}
+
+		for (size_type level = 0; level < fresh->_height; ++level) {
+			link& before = update[level]->_links[level];
+			fresh->_links[level] = { before._next, index[level] + before._span - position };
+			before = { fresh, position + 1 - index[level] };
+		}
+		for (size_type level = fresh->_height; level < _height; ++level)
+			++update[level]->_links[level]._span;
+		++_size;
+	}
+
+	/**< Unlinks the node after the ones trace() found, handing it back */
+	node* unlink(node** update) {
+		node* victim = update[0]->_links[0]._next;
+		for (size_type level = 0; level < victim->_height; ++level) {
+			link& before = update[level]->_links[level];
+			before = { victim->_links[level]._next, before._span + victim->_links[level]._span - 1 };
+		}
+		for (size_type level = victim->_height; level < _height; ++level)
+			--update[level]->_links[level]._span;
+		while (_height > 1 && _head->_links[_height - 1]._next == nullptr)
+			--_height;
+		--_size;
+		return victim;
+	}
+
+	/**
+	 * Rebuilds from a range in O(n), appending each item behind the last
+	 * tower of every level it reaches. The list must be empty.
+	 */
+	template<typename Iterator>
+	void append_range(Iterator first, Iterator last) {
+		node* update[max_height];
+		size_type index[max_height];
+		for (size_type level = 0; level < max_height; ++level) {
+			update[level] = _head;
+			index[level] = 0;
+		}
+		for (; first != last; ++first) {
+			node* fresh = create_node(*first);
+			link_in(fresh, _size, update, index);
+			for (size_type level = 0; level < fresh->_height; ++level) {
+				update[level] = fresh;
+				index[level] = _size;
+			}
+		}
+	}
+
+	template<typename... Args>
+	node* create_node(Args&&... args) {
+		node* p = tower(random_height());
+		try {
+			::new (p->item()) T(std::forward<Args>(args)...);
+		} catch (...) {
+			release(p);
+			throw;
+		}
+		return p;
+	}
+
+	void destroy_node(node* p) {
+		p->item()->~T();
+		release(p);
+	}
+
+	void swap_base(skip_list_base& other) {
+		using std::swap;
+
+		swap(_head, other._head);
+		swap(_height, other._height);
+		swap(_size, other._size);
+		swap(_random, other._random);
+		for (size_type i = 0; i < max_height; ++i)
+			swap(_pools[i], other._pools[i]);
+	}
+
+	node* _head { nullptr };
+	size_type _height { 1 };
+	size_type _size { 0 };
+
+private:
+	/**< A tower of height links, all pointing at the virtual tail */
+	node* tower(size_type height) {
+		std::unique_ptr<memory::memory_pool>& pool = _pools[height - 1];
+		if (!pool)
+			pool.reset(new memory::memory_pool(
+					sizeof(node) + (height - 1) * sizeof(link), alignof(node)));
+		node* p = static_cast<node*>(pool->allocate());
+		p->_height = height;
+		for (size_type i = 0; i < height; ++i)
+			p->_links[i] = { nullptr, 1 };
+		return p;
+	}
+
+	void release(node* p) {
+		_pools[p->_height - 1]->deallocate(p);
+	}
+
+	/**< One level, plus one more with probability 1/4 each, out of an xorshift64* stream */
+	size_type random_height() {
+		_random ^= _random >> 12;
+		_random ^= _random << 25;
+		_random ^= _random >> 27;
+		std::uint64_t bits = _random * 0x2545F4914F6CDD1DULL;
+		size_type height = 1;
+		while (height < max_height && (bits & 3) == 0) {
+			++height;
+			bits >>= 2;
+		}
+		return height;
+	}
+
+	std::uint64_t _random { 0x9E3779B97F4A7C15ULL };
+	std::unique_ptr<memory::memory_pool> _pools[max_height];
+};
+
+/**
+ * Skip list kept in insertion order, where at(), push() and pop() by
+ * position take O(log n) by following link spans instead of walking.
+ */
+template<typename T>
+class indexed_skip_list: public static_list<indexed_skip_list<T>, T>, private skip_list_base<T> {
+	using base = skip_list_base<T>;
+	using typename base::node;
+	using base::max_height;
+
+	using init_list = std::initializer_list<T>;
+	using self = indexed_skip_list<T>;
+	using parent = static_list<self, T>;
+	using size_type = std::size_t;
+
+public:
+	indexed_skip_list() = default;
+
+	indexed_skip_list(const self& other) {
+		this->append_range(other.begin(), other.end());
+	}
+
+	indexed_skip_list(self&& other) {
+		this->swap_base(other);
+	}
+
+	indexed_skip_list(const init_list& items) {
+		this->append_range(items.begin(), items.end());
+	}
+
+	T at(size_type position) const {
+		if (position >= this->_size)
+			throw std::out_of_range("Out of range access.");
+
+		return *this->find(position)->item();
+	}
+
+	T back() const {
+		empty_check();
+
+		return *this->find(this->_size - 1)->item();
+	}
+
+	T front() const {
+		empty_check();
+
+		return *this->_head->_links[0]._next->item();
+	}
+
+	size_type size() const {
+		return this->_size;
+	}
+
+	/**< Removal operations */
+	T pop(size_type position) {
+		if (position >= this->_size)
+			throw std::out_of_range("Empty list.");
+
+		node* update[max_height];
+		size_type index[max_height];
+		this->trace(position, update, index);
+		node* victim = this->unlink(update);
+		T item = std::move(*victim->item());
+		this->destroy_node(victim);
+		return item;
+	}
+
+	T pop_back() {
+		empty_check();
+
+		return pop(this->_size - 1);
+	}
+
+	T pop_front() {
+		empty_check();
+
+		return pop(0);
+	}
+
+	/**< Insertion operations */
+	void push(size_type position, const T& item) {
+		emplace(position, item);
+	}
+
+	void push(size_type position, T&& item) {
+		emplace(position, std::move(item));
+	}
+
+	void push_back(const T& item) {
+		emplace(this->_size, item);
+	}
+
+	void push_back(T&& item) {
+		emplace(this->_size, std::move(item));
+	}
+
+	void push_front(const T& item) {
+		emplace(0, item);
+	}
+
+	void push_front(T&& item) {
+		emplace(0, std::move(item));
+	}
+
+	/**< Builds the item in place out of args, inside its tower */
+	template<typename... Args>
+	void emplace(size_type position, Args&&... args) {
+		if (position > this->_size)
+			throw std::out_of_range("Out of range access.");
+
+		node* update[max_height];
+		size_type index[max_height];
+		this->trace(position, update, index);
+		this->link_in(this->create_node(std::forward<Args>(args)...), position, update, index);
+	}
+
+	template<typename... Args>
+	void emplace_back(Args&&... args) {
+		emplace(this->_size, std::forward<Args>(args)...);
+	}
+
+	template<typename... Args>
+	void emplace_front(Args&&... args) {
+		emplace(0, std::forward<Args>(args)...);
+	}
+
+	using iterator = typename base::template iterator_base<T>;
+
+	iterator begin() {
+		return {this->_head->_links[0]._next};
+	}
+
+	iterator end() {
+		return {nullptr};
+	}
+
+	using const_iterator = typename base::template iterator_base<const T>;
+
+	const_iterator begin() const {
+		return {this->_head->_links[0]._next};
+	}
+
+	const_iterator end() const {
+		return {nullptr};
+	}
+
+	self& operator=(self rhs) {
+		swap(*this, rhs);
+		return *this;
+	}
+
+	bool operator==(const self& rhs) const {
+		return this->_size == rhs._size && std::equal(begin(), end(), rhs.begin());
+	}
+
+	bool operator==(const init_list& rhs) const {
+		return this->_size == rhs.size() && std::equal(rhs.begin(), rhs.end(), begin());
+	}
+
+	bool operator!=(const self& rhs) const {
+		return !(*this == rhs);
+	}
+
+	friend void swap(self& a, self& b) {
+		a.swap_base(b);
+	}
+
+private:
+	void empty_check() const {
+		if (!this->_size)
+			throw std::out_of_range("Empty list.");
+	}
+};
+
+/**
+ * Ordered set over a skip list. Lookups, insertions and removals take
+ * O(log n) expected time, and the spans give select() and rank() for free.
+ */
+template<typename T, template<typename...> class Container = doubly_linked_list>
+class skip_list: public static_tree<skip_list<T, Container>, T, Container>, private skip_list_base<T> {
+	using base = skip_list_base<T>;
+	using typename base::node;
+	using base::max_height;
+
+	using self = skip_list<T, Container>;
+	using size_type = std::size_t;
+
+	/**< Like trace(), but towards the first node not smaller than item */
+	void trace(const T& item, node** update, size_type* index) const {
+		node* p = this->_head;
+		size_type at = 0;
+		size_type level = this->_height;
+		do {
+			--level;
+			node* next;
+			while ((next = p->_links[level]._next) != nullptr && *next->item() < item) {
+				at += p->_links[level]._span;
+				p = next;
+			}
+			update[level] = p;
+			index[level] = at;
+		} while (level > 0);
+	}
+
+	/**< First node not smaller than item, or null */
+	node* lower_bound_node(const T& item) const {
+		node* p = this->_head;
+		for (size_type level = this->_height; level-- > 0;) {
+			node* next;
+			while ((next = p->_links[level]._next) != nullptr && *next->item() < item)
+				p = next;
+		}
+		return p->_links[0]._next;
+	}
+
+	Container<T> collect() const {
+		Container<T> container;
+		for (const T& item : *this)
+			container.push_back(item);
+		return container;
+	}
+
+public:
+	skip_list() = default;
+
+	skip_list(const self& other) {
+		this->append_range(other.begin(), other.end());
+	}
+
+	skip_list(self&& other) {
+		this->swap_base(other);
+	}
+
+	bool has(const T& item) const {
+		node* found = lower_bound_node(item);
+		return found != nullptr && !(item < *found->item());
+	}
+
+	size_type size() const {
+		return this->_size;
+	}
+
+	void insert(const T& item) {
+		emplace(item);
+	}
+
+	void insert(T&& item) {
+		emplace(std::move(item));
+	}
+
+	/**< Builds the item in place out of args first, since it takes an item to find its place */
+	template<typename... Args>
+	void emplace(Args&&... args) {
+		node* fresh = this->create_node(std::forward<Args>(args)...);
+		node* update[max_height];
+		size_type index[max_height];
+		trace(*fresh->item(), update, index);
+
+		node* next = update[0]->_links[0]._next;
+		if (next != nullptr && !(*fresh->item() < *next->item())) {
+			this->destroy_node(fresh);
+			// TODO: find a better exception to throw.
+			throw std::exception();
+		}
+		this->link_in(fresh, index[0], update, index);
+	}
+
+	void remove(const T& item) {
+		node* update[max_height];
+		size_type index[max_height];
+		trace(item, update, index);
+
+		// If the item is not in this list, we have an exception.
+		node* next = update[0]->_links[0]._next;
+		if (next == nullptr || item < *next->item())
+			throw std::exception();
+		this->destroy_node(this->unlink(update));
+	}
+
+	/**< Skip lists have no tree shape, so all three orders are the sorted one */
+	Container<T> in_order() const {
+		return collect();
+	}
+
+	Container<T> pre_order() const {
+		return collect();
+	}
+
+	Container<T> post_order() const {
+		return collect();
+	}
+
+	/**< The k-th smallest item, counting from zero */
+	T select(size_type k) const {
+		if (k >= this->_size)
+			throw std::out_of_range("Out of range access.");
+
+		return *this->find(k)->item();
+	}
+
+	/**< How many items are smaller than item */
+	size_type rank(const T& item) const {
+		node* update[max_height];
+		size_type index[max_height];
+		trace(item, update, index);
+		return index[0];
+	}
+
+	using iterator = typename base::template iterator_base<const T>;
+	using const_iterator = iterator;
+
+	iterator begin() const {
+		return {this->_head->_links[0]._next};
+	}
+
+	iterator end() const {
+		return {nullptr};
+	}
+
+	/**< First item not smaller than item */
+	iterator lower_bound(const T& item) const {
+		return {lower_bound_node(item)};
+	}
+
+	self& operator=(self rhs) {
+		swap(*this, rhs);
+		return *this;
+	}
+
+	friend void swap(self& a, self& b) {
+		a.swap_base(b);
+	}
+};
+
+}
+}
+
+#endif /* SKIP_LIST_H_ */
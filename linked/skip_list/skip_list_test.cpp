@@ -0,0 +1,209 @@
+#include <gtest/gtest.h>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+#include "skip_list.h"
+
+using data_structures::linked::indexed_skip_list;
+using data_structures::linked::skip_list;
+
+class indexed_skip_list_test: public testing::Test {
+public:
+	indexed_skip_list<int> list;
+};
+
+TEST_F(indexed_skip_list_test, isCreatedEmpty) {
+	EXPECT_EQ(0, list.size());
+	EXPECT_TRUE(list.begin() == list.end());
+	EXPECT_THROW(list.front(), std::out_of_range);
+	EXPECT_THROW(list.back(), std::out_of_range);
+	EXPECT_THROW(list.pop_front(), std::out_of_range);
+}
+
+TEST_F(indexed_skip_list_test, pushesOnBothEnds) {
+	list.push_back(1);
+	list.push_front(0);
+	list.push_back(2);
+	EXPECT_TRUE(list == indexed_skip_list<int>({ 0, 1, 2 }));
+	EXPECT_EQ(0, list.front());
+	EXPECT_EQ(2, list.back());
+	EXPECT_THROW(list.at(3), std::out_of_range);
+}
+
+TEST_F(indexed_skip_list_test, pushAndPopByPosition) {
+	list = { 0, 1, 3, 4 };
+	list.push(2, 2);
+	list.push(5, 5);
+	EXPECT_TRUE(list == indexed_skip_list<int>({ 0, 1, 2, 3, 4, 5 }));
+	EXPECT_EQ(3, list.pop(3));
+	EXPECT_EQ(5, list.pop_back());
+	EXPECT_EQ(0, list.pop_front());
+	EXPECT_TRUE(list == indexed_skip_list<int>({ 1, 2, 4 }));
+	EXPECT_THROW(list.push(4, 42), std::out_of_range);
+	EXPECT_THROW(list.pop(3), std::out_of_range);
+}
+
+TEST_F(indexed_skip_list_test, randomOperationsMatchStdVector) {
+	std::vector<int> reference;
+	std::mt19937 random(42);
+	for (int i = 0; i < 20000; ++i) {
+		std::size_t position = random() % (reference.size() + 1);
+		if (random() % 3 != 0 || reference.empty()) {
+			list.push(position, i);
+			reference.insert(reference.begin() + position, i);
+		} else {
+			position %= reference.size();
+			ASSERT_EQ(reference[position], list.pop(position));
+			reference.erase(reference.begin() + position);
+		}
+		ASSERT_EQ(reference.size(), list.size());
+	}
+
+	EXPECT_TRUE(std::equal(reference.begin(), reference.end(), list.begin()));
+	for (std::size_t i = 0; i < reference.size(); ++i)
+		ASSERT_EQ(reference[i], list.at(i));
+}
+
+TEST_F(indexed_skip_list_test, emptiedListIsReusable) {
+	for (int i = 0; i < 1000; ++i)
+		list.push_back(i);
+	for (int i = 0; i < 1000; ++i)
+		EXPECT_EQ(i, list.pop_front());
+	EXPECT_EQ(0, list.size());
+
+	list.push_back(42);
+	EXPECT_EQ(42, list.at(0));
+}
+
+TEST_F(indexed_skip_list_test, emplaceBuildsInPlace) {
+	indexed_skip_list<std::string> strings;
+	strings.emplace_back(3, 'b');
+	strings.emplace_front(3, 'a');
+	strings.emplace(1, "ab");
+	EXPECT_TRUE(strings == indexed_skip_list<std::string>({ "aaa", "ab", "bbb" }));
+}
+
+TEST_F(indexed_skip_list_test, copyAndMove) {
+	for (int i = 0; i < 100; ++i)
+		list.push_back(i);
+	indexed_skip_list<int> copy(list);
+	EXPECT_TRUE(copy == list);
+	EXPECT_EQ(50, copy.at(50));
+	copy.pop(50);
+	EXPECT_TRUE(copy != list);
+
+	indexed_skip_list<int> moved(std::move(copy));
+	EXPECT_EQ(0, copy.size());
+	EXPECT_EQ(99, moved.size());
+	list = moved;
+	EXPECT_TRUE(list == moved);
+	EXPECT_EQ(51, list.at(50));
+}
+
+class skip_list_test: public testing::Test {
+public:
+	skip_list<int> set;
+};
+
+TEST_F(skip_list_test, isCreatedEmpty) {
+	EXPECT_EQ(0, set.size());
+	EXPECT_FALSE(set.has(42));
+}
+
+TEST_F(skip_list_test, insertAndRemove) {
+	set.insert(42);
+	set.insert(13);
+	set.insert(1963);
+	EXPECT_EQ(3, set.size());
+	EXPECT_TRUE(set.has(13));
+	set.remove(13);
+	EXPECT_FALSE(set.has(13));
+	EXPECT_EQ(2, set.size());
+}
+
+TEST_F(skip_list_test, repeatedOrMissingItemsThrow) {
+	set.insert(42);
+	EXPECT_THROW(set.insert(42), std::exception);
+	EXPECT_EQ(1, set.size());
+	EXPECT_THROW(set.remove(13), std::exception);
+	set.remove(42);
+	EXPECT_THROW(set.remove(42), std::exception);
+}
+
+TEST_F(skip_list_test, traversalsAreSorted) {
+	for (int key : { 5, 3, 8, 1, 4 })
+		set.insert(key);
+	EXPECT_EQ(set.in_order(), set.pre_order());
+	EXPECT_EQ(set.in_order(), set.post_order());
+
+	auto in_order = set.in_order();
+	int expected[] = { 1, 3, 4, 5, 8 };
+	for (int i = 0; i < 5; ++i)
+		EXPECT_EQ(expected[i], in_order.at(i));
+}
+
+TEST_F(skip_list_test, selectAndRank) {
+	for (int key = 0; key < 100; key += 2)
+		set.insert(key);
+	EXPECT_EQ(0, set.select(0));
+	EXPECT_EQ(42, set.select(21));
+	EXPECT_EQ(98, set.select(49));
+	EXPECT_THROW(set.select(50), std::out_of_range);
+
+	EXPECT_EQ(0, set.rank(0));
+	EXPECT_EQ(21, set.rank(42));
+	EXPECT_EQ(22, set.rank(43));
+	EXPECT_EQ(50, set.rank(1000));
+}
+
+TEST_F(skip_list_test, lowerBoundStartsRangeScans) {
+	for (int key = 0; key < 100; key += 10)
+		set.insert(key);
+	auto it = set.lower_bound(25);
+	EXPECT_EQ(30, *it);
+	EXPECT_EQ(40, *++it);
+	EXPECT_TRUE(set.lower_bound(91) == set.end());
+}
+
+TEST_F(skip_list_test, randomOperationsMatchStdSet) {
+	std::set<int> reference;
+	std::mt19937 random(42);
+	std::uniform_int_distribution<int> keys(0, 999);
+
+	for (int i = 0; i < 20000; ++i) {
+		int key = keys(random);
+		if (reference.count(key)) {
+			set.remove(key);
+			reference.erase(key);
+		} else {
+			set.insert(key);
+			reference.insert(key);
+		}
+		ASSERT_EQ(reference.size(), set.size());
+	}
+
+	EXPECT_TRUE(std::equal(reference.begin(), reference.end(), set.begin()));
+	std::size_t rank = 0;
+	for (int key : reference) {
+		ASSERT_EQ(rank, set.rank(key));
+		ASSERT_EQ(key, set.select(rank++));
+	}
+}
+
+TEST_F(skip_list_test, copyAndMove) {
+	for (int key = 0; key < 100; ++key)
+		set.insert(key);
+	skip_list<int> copy(set);
+	EXPECT_EQ(100, copy.size());
+	EXPECT_EQ(50, copy.select(50));
+	copy.remove(50);
+	EXPECT_TRUE(set.has(50));
+
+	skip_list<int> moved(std::move(copy));
+	EXPECT_EQ(0, copy.size());
+	EXPECT_FALSE(moved.has(50));
+	set = moved;
+	EXPECT_EQ(99, set.size());
+	EXPECT_EQ(51, set.select(50));
+}
@@ -0,0 +1,547 @@
+#ifndef UNROLLED_LINKED_LIST_H_
+#define UNROLLED_LINKED_LIST_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "abstract/list.h"
+#include "memory/pool_allocator/pool_allocator.h"
+
+namespace data_structures {
+namespace linked {
+
+using abstract::static_list;
+
+/**< Items per block that fit a 64 byte cache line next to the block links and counters, at least two */
+template<typename T>
+constexpr std::size_t cache_line_items() {
+	return 2 * sizeof(T) < 64 - 3 * sizeof(void*) ? (64 - 3 * sizeof(void*)) / sizeof(T) : 2;
+}
+
+/**
+ * Doubly linked list of blocks holding up to K items each, kept in a
+ * contiguous run of slots somewhere inside the block.
+ *
+ * Iterating reads K neighbouring items per pointer chase, and at() skips
+ * whole blocks. Pushing into a full block splits it in two halves; popping
+ * from the middle of a block under half full merges it with, or borrows
+ * from, its successor. A block pushed onto the back fills upwards from its
+ * first slot and one pushed onto the front downwards from its last, so
+ * pushes and pops at either end never shift items.
+ */
+template<typename T, std::size_t K = cache_line_items<T>(), typename Allocator = memory::pool_allocator<T>>
+class unrolled_linked_list: public static_list<unrolled_linked_list<T, K, Allocator>, T> {
+	static_assert(K >= 2, "Blocks must hold at least two items.");
+	static_assert(K <= UINT32_MAX, "Blocks count their items in 32 bits.");
+
+private:
+	using size_type = std::size_t;
+
+	struct block {
+		block(block* pred, block* succ, size_type first) :
+				_pred(pred), _succ(succ), _first(first) {
+		}
+
+		/**< The i-th item held, counting from the first occupied slot */
+		T* item(size_type i) {
+			return reinterpret_cast<T*>(&_slots[_first + i]);
+		}
+
+		bool room_before() const {
+			return _first > 0;
+		}
+
+		bool room_after() const {
+			return _first + _count < K;
+		}
+
+		block* _pred;
+		block* _succ;
+		std::uint32_t _first;
+		std::uint32_t _count { 0 };
+		typename std::aligned_storage<sizeof(T), alignof(T)>::type _slots[K];
+	};
+
+	template<typename NodeT>
+	class iterator_base {
+	public:
+		using iterator_category = std::bidirectional_iterator_tag;
+		using value_type = typename std::remove_const<NodeT>::type;
+		using difference_type = std::ptrdiff_t;
+		using pointer = NodeT*;
+		using reference = NodeT&;
+
+		iterator_base(block* ptr, size_type index) :
+				_ptr(ptr), _index(index) {
+		}
+
+		iterator_base& operator++() {
+			if (_ptr == nullptr)
+				throw std::out_of_range("Iterating beyond list end.");
+			if (++_index == _ptr->_count) {
+				_ptr = _ptr->_succ;
+				_index = 0;
+			}
+			return *this;
+		}
+
+		iterator_base operator++(int) {
+			iterator_base old = *this;
+			++(*this);
+			return old;
+		}
+
+		iterator_base& operator--() {
+			if (_ptr == nullptr)
+				throw std::out_of_range("Iterating beyond list begin.");
+			if (_index-- == 0) {
+				_ptr = _ptr->_pred;
+				_index = _ptr == nullptr ? 0 : _ptr->_count - 1;
+			}
+			return *this;
+		}
+
+		iterator_base operator--(int) {
+			iterator_base old = *this;
+			--(*this);
+			return old;
+		}
+
+		bool operator==(const iterator_base& other) const {
+			return _ptr == other._ptr && _index == other._index;
+		}
+
+		bool operator!=(const iterator_base& other) const {
+			return !(*this == other);
+		}
+
+		NodeT& operator*() const {
+			return *_ptr->item(_index);
+		}
+
+		NodeT* operator->() const {
+			return _ptr->item(_index);
+		}
+
+	private:
+		block* _ptr;
+		size_type _index;
+	};
+
+	using init_list = std::initializer_list<T>;
+	using self = unrolled_linked_list<T, K, Allocator>;
+	using parent = static_list<self, T>;
+	using block_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<block>;
+	using block_traits = std::allocator_traits<block_allocator>;
+
+public:
+	using allocator_type = Allocator;
+
+	unrolled_linked_list() = default;
+
+	unrolled_linked_list(const self& other) :
+			_alloc(block_traits::select_on_container_copy_construction(other._alloc)) {
+		for (const T& item : other)
+			push_back(item);
+	}
+
+	unrolled_linked_list(self&& other) {
+		swap(*this, other);
+	}
+
+	unrolled_linked_list(const init_list& items) {
+		for (const T& item : items)
+			push_back(item);
+	}
+
+	~unrolled_linked_list() {
+		while (_front != nullptr) {
+			block* old = _front;
+			_front = _front->_succ;
+			for (size_type i = 0; i < old->_count; ++i)
+				old->item(i)->~T();
+			destroy_block(old);
+		}
+	}
+
+	T at(size_type position) const {
+		if (position >= _size)
+			throw std::out_of_range("Out of range access.");
+
+		block* b = find(position);
+		return *b->item(position);
+	}
+
+	T back() const {
+		empty_check();
+
+		return *_back->item(_back->_count - 1);
+	}
+
+	T front() const {
+		empty_check();
+
+		return *_front->item(0);
+	}
+
+	size_type size() const {
+		return _size;
+	}
+
+	/**< Removal operations */
+	T pop(size_type position) {
+		if (position >= _size)
+			throw std::out_of_range("Empty list.");
+
+		if (position == 0)
+			return pop_front();
+
+		if (position == _size - 1)
+			return pop_back();
+
+		block* b = find(position);
+		T item = erase(b, position);
+		if (b->_count == 0)
+			unlink(b);
+		else if (b->_count < K / 2 && b->_succ != nullptr)
+			refill(b);
+		return item;
+	}
+
+	T pop_back() {
+		empty_check();
+
+		block* b = _back;
+		T item = erase(b, b->_count - 1);
+		if (b->_count == 0)
+			unlink(b);
+		return item;
+	}
+
+	T pop_front() {
+		empty_check();
+
+		block* b = _front;
+		T item = erase(b, 0);
+		if (b->_count == 0)
+			unlink(b);
+		return item;
+	}
+
+	/**< Insertion operations */
+	void push(size_type position, const T& item) {
+		emplace(position, item);
+	}
+
+	void push(size_type position, T&& item) {
+		emplace(position, std::move(item));
+	}
+
+	void push_back(const T& item) {
+		emplace_back(item);
+	}
+
+	void push_back(T&& item) {
+		emplace_back(std::move(item));
+	}
+
+	void push_front(const T& item) {
+		emplace_front(item);
+	}
+
+	void push_front(T&& item) {
+		emplace_front(std::move(item));
+	}
+
+	/**< Builds the item out of args inside its block, splitting the block if full */
+	template<typename... Args>
+	void emplace(size_type position, Args&&... args) {
+		if (position > _size)
+			throw std::out_of_range("Out of range access.");
+
+		if (position == _size) {
+			emplace_back(std::forward<Args>(args)...);
+			return;
+		}
+
+		block* b = find(position);
+		if (b->_count == K) {
+			// Built first, as args may refer to an item about to be moved.
+			T item(std::forward<Args>(args)...);
+			block* upper = split(b);
+			if (position > b->_count)
+				insert(upper, position - b->_count, std::move(item));
+			else
+				insert(b, position, std::move(item));
+			return;
+		}
+		insert(b, position, std::forward<Args>(args)...);
+	}
+
+	template<typename... Args>
+	void emplace_back(Args&&... args) {
+		if (_back == nullptr || !_back->room_after()) {
+			block* fresh = create_block_with(_back, nullptr, 0, std::forward<Args>(args)...);
+			if (_back == nullptr)
+				_front = fresh;
+			else
+				_back->_succ = fresh;
+			_back = fresh;
+		} else {
+			::new (_back->item(_back->_count)) T(std::forward<Args>(args)...);
+			++_back->_count;
+		}
+		++_size;
+	}
+
+	template<typename... Args>
+	void emplace_front(Args&&... args) {
+		if (_front == nullptr || !_front->room_before()) {
+			block* fresh = create_block_with(nullptr, _front, K - 1, std::forward<Args>(args)...);
+			if (_front == nullptr)
+				_back = fresh;
+			else
+				_front->_pred = fresh;
+			_front = fresh;
+		} else {
+			::new (_front->item(0) - 1) T(std::forward<Args>(args)...);
+			--_front->_first;
+			++_front->_count;
+		}
+		++_size;
+	}
+
+	using iterator = iterator_base<T>;
+
+	iterator begin() {
+		return {_front, 0};
+	}
+
+	iterator end() {
+		return {nullptr, 0};
+	}
+
+	iterator rbegin() {
+		return {_back, _back == nullptr ? 0 : _back->_count - 1};
+	}
+
+	iterator rend() {
+		return {nullptr, 0};
+	}
+
+	using const_iterator = iterator_base<const T>;
+
+	const_iterator begin() const {
+		return {_front, 0};
+	}
+
+	const_iterator end() const {
+		return {nullptr, 0};
+	}
+
+	const_iterator rbegin() const {
+		return {_back, _back == nullptr ? 0 : _back->_count - 1};
+	}
+
+	const_iterator rend() const {
+		return {nullptr, 0};
+	}
+
+	self& operator=(self&& rhs) {
+		swap(*this, rhs);
+		return *this;
+	}
+
+	bool operator==(const self& rhs) const {
+		return _size == rhs._size && std::equal(begin(), end(), rhs.begin());
+	}
+
+	bool operator==(const init_list& rhs) const {
+		return _size == rhs.size() && std::equal(rhs.begin(), rhs.end(), begin());
+	}
+
+	bool operator!=(const self& rhs) const {
+		return !(*this == rhs);
+	}
+
+	friend void swap(self& a, self& b) {
+		using std::swap;
+
+		swap(a._front, b._front);
+		swap(a._back, b._back);
+		swap(a._size, b._size);
+		swap(a._alloc, b._alloc);
+	}
+
+private:
+	void empty_check() const {
+		if (!_size)
+			throw std::out_of_range("Empty list.");
+	}
+
+	/**< Block holding position, walking from the nearer end; position becomes the offset inside it */
+	block* find(size_type& position) const {
+		block* b;
+		if (position < (_size >> 1)) {
+			b = _front;
+			while (position >= b->_count) {
+				position -= b->_count;
+				b = b->_succ;
+			}
+		} else {
+			b = _back;
+			size_type first = _size - b->_count;
+			while (position < first) {
+				b = b->_pred;
+				first -= b->_count;
+			}
+			position -= first;
+		}
+		return b;
+	}
+
+	/**
+	 * Builds the new item at offset, shifting the items before it one slot
+	 * down or those from it on one slot up, whichever side has room and is
+	 * shorter; b must not be full.
+	 */
+	template<typename... Args>
+	void insert(block* b, size_type offset, Args&&... args) {
+		bool up = b->room_after() && (!b->room_before() || offset >= b->_count / 2);
+		if (up && offset == b->_count) {
+			::new (b->item(offset)) T(std::forward<Args>(args)...);
+		} else if (!up && offset == 0) {
+			::new (b->item(0) - 1) T(std::forward<Args>(args)...);
+			--b->_first;
+		} else {
+			T item(std::forward<Args>(args)...);
+			if (up) {
+				::new (b->item(b->_count)) T(std::move(*b->item(b->_count - 1)));
+				std::move_backward(b->item(offset), b->item(b->_count - 1), b->item(b->_count));
+			} else {
+				::new (b->item(0) - 1) T(std::move(*b->item(0)));
+				--b->_first;
+				std::move(b->item(2), b->item(offset + 1), b->item(1));
+			}
+			*b->item(offset) = std::move(item);
+		}
+		++b->_count;
+		++_size;
+	}
+
+	/**< Takes the item at offset out of b, closing the gap from the shorter side */
+	T erase(block* b, size_type offset) {
+		T item = std::move(*b->item(offset));
+		if (offset < b->_count / 2) {
+			std::move_backward(b->item(0), b->item(offset), b->item(offset + 1));
+			b->item(0)->~T();
+			++b->_first;
+		} else {
+			std::move(b->item(offset + 1), b->item(b->_count), b->item(offset));
+			b->item(b->_count - 1)->~T();
+		}
+		--b->_count;
+		--_size;
+		return item;
+	}
+
+	/**< Moves the upper half of the full block b into a new block right after it */
+	block* split(block* b) {
+		block* upper = create_block(b, b->_succ, 0);
+		const size_type half = K / 2;
+		for (size_type i = half; i < K; ++i) {
+			::new (upper->item(i - half)) T(std::move(*b->item(i)));
+			b->item(i)->~T();
+		}
+		upper->_count = K - half;
+		b->_count = half;
+
+		if (b->_succ == nullptr)
+			_back = upper;
+		else
+			b->_succ->_pred = upper;
+		b->_succ = upper;
+		return upper;
+	}
+
+	/**< Brings b back to half full from its successor, merging the two if they fit one block */
+	void refill(block* b) {
+		block* succ = b->_succ;
+		size_type moving = b->_count + succ->_count <= K ? succ->_count : K / 2 - b->_count;
+
+		// Slide b down to its first slot so everything taken fits after its items.
+		if (b->_first + b->_count + moving > K) {
+			for (size_type i = 0; i < b->_count; ++i) {
+				::new (&b->_slots[i]) T(std::move(*b->item(i)));
+				b->item(i)->~T();
+			}
+			b->_first = 0;
+		}
+
+		for (size_type i = 0; i < moving; ++i) {
+			::new (b->item(b->_count++)) T(std::move(*succ->item(i)));
+			succ->item(i)->~T();
+		}
+		if (moving == succ->_count) {
+			unlink(succ);
+			return;
+		}
+		succ->_first += moving;
+		succ->_count -= moving;
+	}
+
+	void unlink(block* b) {
+		if (b->_pred == nullptr)
+			_front = b->_succ;
+		else
+			b->_pred->_succ = b->_succ;
+		if (b->_succ == nullptr)
+			_back = b->_pred;
+		else
+			b->_succ->_pred = b->_pred;
+		destroy_block(b);
+	}
+
+	block* create_block(block* pred, block* succ, size_type first) {
+		block* p = block_traits::allocate(_alloc, 1);
+		block_traits::construct(_alloc, p, pred, succ, first);
+		return p;
+	}
+
+	/**< A new block holding a single item, built out of args in the given slot */
+	template<typename... Args>
+	block* create_block_with(block* pred, block* succ, size_type slot, Args&&... args) {
+		block* p = create_block(pred, succ, slot);
+		try {
+			::new (p->item(0)) T(std::forward<Args>(args)...);
+		} catch (...) {
+			destroy_block(p);
+			throw;
+		}
+		p->_count = 1;
+		return p;
+	}
+
+	/**< Releases a block whose items are already gone */
+	void destroy_block(block* p) {
+		block_traits::destroy(_alloc, p);
+		block_traits::deallocate(_alloc, p, 1);
+	}
+
+	block_allocator _alloc;
+	block* _front { nullptr };
+	block* _back { nullptr };
+	size_type _size { 0 };
+};
+
+}
+}
+
+#endif /* UNROLLED_LINKED_LIST_H_ */
@@ -0,0 +1,164 @@
+#include <gtest/gtest.h>
+#include <random>
+#include <string>
+#include <vector>
+#include "unrolled_linked_list.h"
+
+using data_structures::linked::unrolled_linked_list;
+
+/**< Four items per block, so a handful of pushes already splits and merges blocks */
+using small_list = unrolled_linked_list<int, 4>;
+
+class unrolled_linked_list_test: public testing::Test {
+public:
+	unrolled_linked_list<int> list;
+	small_list small;
+};
+
+TEST_F(unrolled_linked_list_test, isCreatedEmpty) {
+	EXPECT_EQ(0, list.size());
+	EXPECT_TRUE(list.begin() == list.end());
+	EXPECT_THROW(list.front(), std::out_of_range);
+	EXPECT_THROW(list.back(), std::out_of_range);
+}
+
+TEST_F(unrolled_linked_list_test, fillsCacheLineBlocks) {
+	EXPECT_EQ(10, data_structures::linked::cache_line_items<int>());
+	EXPECT_EQ(5, data_structures::linked::cache_line_items<long>());
+	EXPECT_EQ(2, data_structures::linked::cache_line_items<std::string>());
+}
+
+TEST_F(unrolled_linked_list_test, pushesOnBothEnds) {
+	for (int i = 0; i < 10; ++i) {
+		small.push_back(i);
+		small.push_front(-i - 1);
+	}
+	EXPECT_EQ(20, small.size());
+	EXPECT_EQ(-10, small.front());
+	EXPECT_EQ(9, small.back());
+	for (int i = 0; i < 20; ++i)
+		EXPECT_EQ(i - 10, small.at(i));
+	EXPECT_THROW(small.at(20), std::out_of_range);
+}
+
+TEST_F(unrolled_linked_list_test, popsFromBothEnds) {
+	small = { 0, 1, 2, 3, 4, 5, 6, 7, 8 };
+	for (int i = 0; i < 4; ++i) {
+		EXPECT_EQ(i, small.pop_front());
+		EXPECT_EQ(8 - i, small.pop_back());
+	}
+	EXPECT_EQ(4, small.pop_back());
+	EXPECT_THROW(small.pop_back(), std::out_of_range);
+	EXPECT_THROW(small.pop_front(), std::out_of_range);
+	EXPECT_TRUE(small.begin() == small.end());
+}
+
+TEST_F(unrolled_linked_list_test, pushIntoFullBlockSplitsIt) {
+	small = { 0, 1, 2, 3 };
+	small.push(2, 42);
+	small.push(1, 13);
+	small.push(6, 1963);
+	EXPECT_TRUE(small == small_list({ 0, 13, 1, 42, 2, 3, 1963 }));
+	EXPECT_THROW(small.push(8, 0), std::out_of_range);
+}
+
+TEST_F(unrolled_linked_list_test, popFromTheMiddleRefillsBlocks) {
+	for (int i = 0; i < 16; ++i)
+		small.push_back(i);
+	for (int i = 0; i < 6; ++i)
+		small.pop(5);
+	EXPECT_TRUE(small == small_list({ 0, 1, 2, 3, 4, 11, 12, 13, 14, 15 }));
+	EXPECT_THROW(small.pop(10), std::out_of_range);
+}
+
+TEST_F(unrolled_linked_list_test, randomOperationsMatchStdVector) {
+	std::vector<int> reference;
+	std::mt19937 random(42);
+	for (int i = 0; i < 5000; ++i) {
+		std::size_t position = random() % (reference.size() + 1);
+		switch (random() % 5) {
+		case 0:
+			small.push_front(i);
+			reference.insert(reference.begin(), i);
+			break;
+		case 1:
+			small.push_back(i);
+			reference.push_back(i);
+			break;
+		case 2:
+			small.push(position, i);
+			reference.insert(reference.begin() + position, i);
+			break;
+		default:
+			if (position < reference.size()) {
+				EXPECT_EQ(reference[position], small.pop(position));
+				reference.erase(reference.begin() + position);
+			}
+		}
+		ASSERT_EQ(reference.size(), small.size());
+	}
+	EXPECT_TRUE(std::equal(reference.begin(), reference.end(), small.begin()));
+	for (std::size_t i = 0; i < reference.size(); i += 7)
+		EXPECT_EQ(reference[i], small.at(i));
+}
+
+TEST_F(unrolled_linked_list_test, iteratesBothWays) {
+	for (int i = 0; i < 10; ++i)
+		small.push_back(i);
+
+	int expected = 0;
+	for (auto it = small.begin(); it != small.end(); ++it)
+		EXPECT_EQ(expected++, *it);
+	for (auto it = small.rbegin(); it != small.rend(); --it)
+		EXPECT_EQ(--expected, *it);
+	EXPECT_EQ(0, expected);
+}
+
+TEST_F(unrolled_linked_list_test, pushOfOwnItemSurvivesSplit) {
+	using pairs = unrolled_linked_list<std::string, 2>;
+	pairs strings { "a", "b" };
+	strings.push(1, *strings.begin());
+	strings.push(0, *++strings.begin());
+	EXPECT_TRUE(strings == pairs({ "a", "a", "a", "b" }));
+}
+
+TEST_F(unrolled_linked_list_test, copyAndMove) {
+	for (int i = 0; i < 25; ++i)
+		list.push_back(i);
+	unrolled_linked_list<int> copy(list);
+	EXPECT_TRUE(copy == list);
+	copy.pop(12);
+	EXPECT_TRUE(copy != list);
+
+	unrolled_linked_list<int> moved(std::move(copy));
+	EXPECT_EQ(0, copy.size());
+	EXPECT_EQ(24, moved.size());
+	list = std::move(moved);
+	EXPECT_EQ(24, list.size());
+	EXPECT_EQ(13, list.at(12));
+}
+
+TEST_F(unrolled_linked_list_test, emplaceWithoutArgumentsBuildsDefaultItems) {
+	using strings = unrolled_linked_list<std::string, 2>;
+	strings items;
+	items.emplace_back();
+	items.emplace_front();
+	EXPECT_EQ(2, items.size());
+
+	// The block is full now, so both ends start new blocks.
+	items.emplace_back();
+	items.emplace_front();
+	EXPECT_EQ(4, items.size());
+
+	int count = 0;
+	for (auto& item : items) {
+		EXPECT_EQ("", item);
+		++count;
+	}
+	EXPECT_EQ(4, count);
+
+	list.emplace_front();
+	list.emplace_back();
+	EXPECT_EQ(0, list.front());
+	EXPECT_EQ(0, list.back());
+}
@@ -0,0 +1,229 @@
+#ifndef EPOCH_H_
+#define EPOCH_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace data_structures {
+namespace memory {
+
+/**
+ * Epoch-based reclamation for structures read without locks.
+ *
+ * Readers pin the domain for as long as they hold pointers into the
+ * structure. Memory unlinked by a writer is retired instead of released, and
+ * only reclaimed once every reader that was pinned at the time has left, which
+ * is known when the global epoch has advanced twice since.
+ *
+ * Threads claim a record on every pin and give it back when unpinned, so no
+ * thread ever has to register or unregister. Memory retired through a record
+ * stays there until that record is claimed again or the domain is destroyed.
+ */
+class epoch_domain {
+	using size_type = std::size_t;
+	using epoch_type = std::uint64_t;
+	using reclaimer = void (*)(void* ptr, void* context);
+
+	struct retired {
+		void* _ptr;
+		reclaimer _reclaim;
+		void* _context;
+	};
+
+	struct limbo {
+		epoch_type _epoch { 0 };
+		std::vector<retired> _items;
+	};
+
+	/**
+	 * Records are only held while pinned, so the announced epoch doubles as
+	 * the claim: zero while free, otherwise twice the epoch plus one.
+	 */
+	struct record {
+		explicit record(epoch_type announced) :
+				_announced(announced) {
+		}
+
+		std::atomic<epoch_type> _announced;
+		record* _next { nullptr };
+		size_type _retired { 0 };
+		limbo _limbo[3];
+	};
+
+	/**< Last record a thread claimed, keyed by domain serial rather than address */
+	struct hint {
+		std::uint64_t _serial;
+		record* _record;
+	};
+
+public:
+	/**< Retirements between attempts at advancing the epoch */
+	static constexpr size_type advance_period = 64;
+
+	/**
+	 * Keeps the pinning thread inside the current epoch until destroyed.
+	 * Anything reachable from the structure when a guard is taken stays
+	 * valid for as long as the guard lives.
+	 */
+	class guard {
+		friend class epoch_domain;
+
+	public:
+		guard(guard&& other) :
+				_domain(other._domain), _record(other._record) {
+			other._record = nullptr;
+		}
+
+		guard(const guard&) = delete;
+		guard& operator=(const guard&) = delete;
+
+		~guard() {
+			if (_record != nullptr)
+				_domain->leave(_record);
+		}
+
+		/**< Hands ptr over to be released through reclaim once no reader can hold it */
+		void retire(void* ptr, reclaimer reclaim, void* context) {
+			_domain->retire(_record, retired { ptr, reclaim, context });
+		}
+
+	private:
+		explicit guard(epoch_domain& domain) :
+				_domain(&domain), _record(domain.enter()) {
+		}
+
+		epoch_domain* _domain;
+		record* _record;
+	};
+
+	epoch_domain() :
+			_serial(++serials()) {
+	}
+
+	epoch_domain(const epoch_domain&) = delete;
+	epoch_domain& operator=(const epoch_domain&) = delete;
+
+	/**< Reclaims everything still retired; no guard may outlive the domain */
+	~epoch_domain() {
+		record* current = _records.load();
+		while (current != nullptr) {
+			record* old = current;
+			current = current->_next;
+			for (auto& bucket : old->_limbo)
+				reclaim(bucket);
+			delete old;
+		}
+	}
+
+	guard pin() {
+		return guard(*this);
+	}
+
+	/**
+	 * Moves the global epoch forward if every pinned reader has caught up
+	 * with it. Retiring calls this periodically; it is public for callers
+	 * that want memory back sooner.
+	 */
+	bool try_advance() {
+		epoch_type epoch = _epoch.load();
+		for (record* r = _records.load(); r != nullptr; r = r->_next) {
+			epoch_type announced = r->_announced.load();
+			if (announced != 0 && announced != epoch * 2 + 1)
+				return false;
+		}
+		return _epoch.compare_exchange_strong(epoch, epoch + 1);
+	}
+
+private:
+	static std::atomic<std::uint64_t>& serials() {
+		static std::atomic<std::uint64_t> counter { 0 };
+		return counter;
+	}
+
+	static hint& thread_hint() {
+		static thread_local hint cached { 0, nullptr };
+		return cached;
+	}
+
+	static bool try_claim(record* r, epoch_type announced) {
+		epoch_type free = 0;
+		return r->_announced.load(std::memory_order_relaxed) == 0
+				&& r->_announced.compare_exchange_strong(free, announced);
+	}
+
+	static void reclaim(limbo& bucket) {
+		for (auto& item : bucket._items)
+			item._reclaim(item._ptr, item._context);
+		bucket._items.clear();
+	}
+
+	/**< Claims a free record, announcing epoch on it in the same step */
+	record* claim(epoch_type epoch) {
+		epoch_type announced = epoch * 2 + 1;
+		hint& cached = thread_hint();
+		if (cached._serial == _serial && try_claim(cached._record, announced))
+			return cached._record;
+
+		record* r = _records.load();
+		while (r != nullptr && !try_claim(r, announced))
+			r = r->_next;
+
+		if (r == nullptr) {
+			// Records are never unlinked, so a plain push is enough.
+			r = new record(announced);
+			r->_next = _records.load();
+			while (!_records.compare_exchange_weak(r->_next, r))
+				;
+		}
+
+		cached = hint { _serial, r };
+		return r;
+	}
+
+	record* enter() {
+		epoch_type epoch = _epoch.load();
+		record* r = claim(epoch);
+		collect(r, epoch);
+		return r;
+	}
+
+	void leave(record* r) {
+		// Only what was read while pinned has to stay above this.
+		r->_announced.store(0, std::memory_order_release);
+	}
+
+	/**< Releases whatever r retired at least two epochs before epoch */
+	void collect(record* r, epoch_type epoch) {
+		for (auto& bucket : r->_limbo)
+			if (!bucket._items.empty() && bucket._epoch + 2 <= epoch)
+				reclaim(bucket);
+	}
+
+	void retire(record* r, retired item) {
+		epoch_type epoch = _epoch.load();
+		limbo& bucket = r->_limbo[epoch % 3];
+		if (bucket._epoch != epoch) {
+			// Whatever shares the bucket is at least three epochs old.
+			reclaim(bucket);
+			bucket._epoch = epoch;
+		}
+		bucket._items.push_back(item);
+
+		if (++r->_retired == advance_period) {
+			r->_retired = 0;
+			if (try_advance())
+				collect(r, _epoch.load());
+		}
+	}
+
+	const std::uint64_t _serial;
+	std::atomic<epoch_type> _epoch { 0 };
+	std::atomic<record*> _records { nullptr };
+};
+
+}
+}
+
+#endif /* EPOCH_H_ */
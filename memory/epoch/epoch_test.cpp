@@ -0,0 +1,97 @@
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+#include "epoch.h"
+
+using data_structures::memory::epoch_domain;
+
+namespace {
+
+void count(void*, void* context) {
+	++*static_cast<int*>(context);
+}
+
+void release(void* ptr, void*) {
+	auto item = static_cast<std::atomic<int>*>(ptr);
+	item->store(-1);
+	delete item;
+}
+
+}
+
+class epoch_test: public testing::Test {
+public:
+	/**< Retires dummies until the periodic advance has had a chance to run */
+	void churn(int rounds) {
+		for (int i = 0; i < rounds; ++i) {
+			auto guard = domain.pin();
+			for (std::size_t j = 0; j < epoch_domain::advance_period; ++j)
+				guard.retire(nullptr, count, &churned);
+		}
+	}
+
+	epoch_domain domain;
+	int reclaimed = 0;
+	int churned = 0;
+};
+
+TEST_F(epoch_test, advancesOnlyWhenReadersCatchUp) {
+	auto reader = domain.pin();
+	EXPECT_TRUE(domain.try_advance());
+	EXPECT_FALSE(domain.try_advance());
+}
+
+TEST_F(epoch_test, advancesFreelyWithoutReaders) {
+	EXPECT_TRUE(domain.try_advance());
+	EXPECT_TRUE(domain.try_advance());
+}
+
+TEST_F(epoch_test, pinnedReaderHoldsRetiredMemory) {
+	{
+		auto reader = domain.pin();
+		{
+			auto writer = domain.pin();
+			writer.retire(nullptr, count, &reclaimed);
+		}
+		churn(10);
+		EXPECT_EQ(0, reclaimed);
+	}
+	churn(10);
+	EXPECT_EQ(1, reclaimed);
+}
+
+TEST_F(epoch_test, destructionReclaimsEverything) {
+	{
+		epoch_domain scoped;
+		auto guard = scoped.pin();
+		guard.retire(nullptr, count, &reclaimed);
+		guard.retire(nullptr, count, &reclaimed);
+	}
+	EXPECT_EQ(2, reclaimed);
+}
+
+TEST_F(epoch_test, concurrentReadersNeverSeeReclaimedMemory) {
+	std::atomic<std::atomic<int>*> shared { new std::atomic<int>(0) };
+	std::atomic<bool> failed { false };
+
+	std::vector<std::thread> threads;
+	for (int t = 0; t < 4; ++t) {
+		threads.emplace_back([&, t] {
+			for (int i = 0; i < 5000; ++i) {
+				auto guard = domain.pin();
+				if (t == 0) {
+					auto old = shared.exchange(new std::atomic<int>(i));
+					guard.retire(old, release, nullptr);
+				} else if (shared.load()->load() < 0) {
+					failed = true;
+				}
+			}
+		});
+	}
+	for (auto& thread : threads)
+		thread.join();
+
+	EXPECT_FALSE(failed);
+	delete shared.load();
+}
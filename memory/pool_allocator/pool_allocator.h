@@ -0,0 +1,332 @@
+#ifndef POOL_ALLOCATOR_H_
+#define POOL_ALLOCATOR_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace data_structures {
+namespace memory {
+
+/**
+ * Pool of fixed-size chunks.
+ *
+ * Chunks are carved sequentially out of slabs, so chunks allocated one after
+ * another sit next to each other in memory. Released chunks go to an
+ * intrusive free list and are handed out again before the slab is touched.
+ * Slabs double in size up to max_slab_chunks and are only returned to the
+ * system when the pool is destroyed.
+ */
+class memory_pool {
+	using size_type = std::size_t;
+
+	struct free_chunk {
+		free_chunk* _next;
+	};
+
+	struct slab {
+		slab* _next;
+	};
+
+public:
+	static constexpr size_type min_slab_chunks = 32;
+	static constexpr size_type max_slab_chunks = 4096;
+
+	memory_pool(size_type chunk_size, size_type alignment = alignof(std::max_align_t)) :
+			_chunk_size(chunk_size_for(chunk_size, alignment)),
+			_header_size(round_up(sizeof(slab), alignof(std::max_align_t))) {
+	}
+
+	memory_pool(const memory_pool&) = delete;
+	memory_pool& operator=(const memory_pool&) = delete;
+
+	~memory_pool() {
+		while (_slabs != nullptr) {
+			slab* old = _slabs;
+			_slabs = _slabs->_next;
+			::operator delete(old);
+		}
+	}
+
+	void* allocate() {
+		// Recycle a released chunk if there is one, otherwise bump the cursor.
+		if (_free != nullptr) {
+			free_chunk* chunk = _free;
+			_free = chunk->_next;
+			if (_free == nullptr)
+				_free_tail = nullptr;
+			return chunk;
+		}
+
+		if (_cursor == _limit)
+			grow(_next_slab_chunks);
+
+		void* chunk = _cursor;
+		_cursor += _chunk_size;
+		return chunk;
+	}
+
+	void deallocate(void* ptr) {
+		free_chunk* chunk = static_cast<free_chunk*>(ptr);
+		chunk->_next = _free;
+		if (_free == nullptr)
+			_free_tail = chunk;
+		_free = chunk;
+	}
+
+	/**
+	 * Takes over every slab of other in O(1), so chunks it handed out may be
+	 * released here from now on. Only the roomier of the two unused slab
+	 * tails is kept; the other one sits idle until the pool is destroyed.
+	 */
+	void absorb(memory_pool& other) {
+		if (other._chunk_size != _chunk_size)
+			throw std::invalid_argument("Absorbing a pool of another chunk size.");
+
+		if (&other == this || other._slabs == nullptr)
+			return;
+
+		other._slabs_tail->_next = _slabs;
+		_slabs = other._slabs;
+		if (_slabs_tail == nullptr)
+			_slabs_tail = other._slabs_tail;
+
+		if (other._free != nullptr) {
+			other._free_tail->_next = _free;
+			if (_free == nullptr)
+				_free_tail = other._free_tail;
+			_free = other._free;
+		}
+
+		if (remaining() < other.remaining()) {
+			_cursor = other._cursor;
+			_limit = other._limit;
+		}
+
+		other._free = other._free_tail = nullptr;
+		other._slabs = other._slabs_tail = nullptr;
+		other._cursor = other._limit = nullptr;
+	}
+
+	/**< Makes room for n more chunks in a single slab */
+	void reserve(size_type n) {
+		if (remaining() < n)
+			grow(n);
+	}
+
+	size_type chunk_size() const {
+		return _chunk_size;
+	}
+
+	/**< Size of the chunks a pool for objects of the given size and alignment hands out */
+	static size_type chunk_size_for(size_type size, size_type alignment) {
+		return round_up(std::max(size, sizeof(free_chunk)), std::max(alignment, alignof(free_chunk)));
+	}
+
+private:
+	static size_type round_up(size_type value, size_type alignment) {
+		return (value + alignment - 1) / alignment * alignment;
+	}
+
+	size_type remaining() const {
+		return static_cast<size_type>(_limit - _cursor) / _chunk_size;
+	}
+
+	void grow(size_type chunks) {
+		if (chunks < min_slab_chunks)
+			chunks = min_slab_chunks;
+
+		// Whatever is left of the current slab is not wasted, just recycled.
+		while (_cursor != _limit) {
+			deallocate(_cursor);
+			_cursor += _chunk_size;
+		}
+
+		char* raw = static_cast<char*>(::operator new(_header_size + chunks * _chunk_size));
+		slab* block = reinterpret_cast<slab*>(raw);
+		block->_next = _slabs;
+		_slabs = block;
+		if (_slabs_tail == nullptr)
+			_slabs_tail = block;
+
+		_cursor = raw + _header_size;
+		_limit = _cursor + chunks * _chunk_size;
+		// Slab sizes double up to a ceiling; an oversized reservation does not raise it.
+		if (_next_slab_chunks < max_slab_chunks)
+			_next_slab_chunks *= 2;
+	}
+
+	size_type _chunk_size;
+	size_type _header_size;
+	size_type _next_slab_chunks { min_slab_chunks };
+	free_chunk* _free { nullptr };
+	free_chunk* _free_tail { nullptr };
+	slab* _slabs { nullptr };
+	slab* _slabs_tail { nullptr };
+	char* _cursor { nullptr };
+	char* _limit { nullptr };
+};
+
+/**
+ * The memory_pools of one allocator and everything rebound from it, one per
+ * chunk size. Pools are created on first use and all live as long as the
+ * arena.
+ */
+class memory_arena {
+	using size_type = std::size_t;
+
+public:
+	memory_arena() = default;
+	memory_arena(const memory_arena&) = delete;
+	memory_arena& operator=(const memory_arena&) = delete;
+
+	memory_pool& pool(size_type size, size_type alignment) {
+		const size_type chunk_size = memory_pool::chunk_size_for(size, alignment);
+		for (auto& pool : _pools)
+			if (pool->chunk_size() == chunk_size)
+				return *pool;
+
+		// Chunks are laid out by their size alone, which already fits the alignment.
+		std::unique_ptr<memory_pool> pool(new memory_pool(chunk_size, 1));
+		_pools.push_back(std::move(pool));
+		return *_pools.back();
+	}
+
+	/**< Takes over every pool of other, merging those of a chunk size this arena has */
+	void absorb(memory_arena& other) {
+		if (&other == this)
+			return;
+		for (auto& theirs : other._pools)
+			pool(theirs->chunk_size(), 1).absorb(*theirs);
+	}
+
+private:
+	std::vector<std::unique_ptr<memory_pool>> _pools;
+};
+
+/**
+ * Standard allocator backed by a memory_pool.
+ *
+ * Copies and rebound copies share one memory_arena, each type drawing from
+ * the pool of its chunk size, so any of them may release what another one
+ * allocated, and rebinding back gives an equal allocator. Only single-object
+ * requests are pooled; arrays fall back to the global operator new.
+ */
+template<typename T>
+class pool_allocator {
+	static_assert(alignof(T) <= alignof(std::max_align_t),
+			"Over-aligned types are not supported by pool_allocator.");
+
+	template<typename U>
+	friend class pool_allocator;
+
+public:
+	using value_type = T;
+	using size_type = std::size_t;
+	using propagate_on_container_copy_assignment = std::true_type;
+	using propagate_on_container_move_assignment = std::true_type;
+	using propagate_on_container_swap = std::true_type;
+
+	template<typename U>
+	struct rebind {
+		using other = pool_allocator<U>;
+	};
+
+	pool_allocator() :
+			_arena(std::make_shared<memory_arena>()), _pool(&_arena->pool(sizeof(T), alignof(T))) {
+	}
+
+	template<typename U>
+	pool_allocator(const pool_allocator<U>& other) :
+			_arena(other._arena), _pool(&_arena->pool(sizeof(T), alignof(T))) {
+	}
+
+	T* allocate(size_type n) {
+		if (n == 1)
+			return static_cast<T*>(_pool->allocate());
+		return static_cast<T*>(::operator new(n * sizeof(T)));
+	}
+
+	void deallocate(T* ptr, size_type n) {
+		if (n == 1)
+			_pool->deallocate(ptr);
+		else
+			::operator delete(ptr);
+	}
+
+	void reserve(size_type n) {
+		_pool->reserve(n);
+	}
+
+	/**
+	 * Makes memory allocated through other releasable through this allocator.
+	 * Fails when other's arena is still shared, rebound copies included,
+	 * since absorbing it would pull memory out from under its other users.
+	 */
+	bool absorb(pool_allocator& other) {
+		if (*this == other)
+			return true;
+		if (other._arena.use_count() != 1)
+			return false;
+		_arena->absorb(*other._arena);
+		return true;
+	}
+
+	/**< Copied containers get a pool of their own instead of sharing ours */
+	pool_allocator select_on_container_copy_construction() const {
+		return {};
+	}
+
+	template<typename U>
+	friend bool operator==(const pool_allocator& a, const pool_allocator<U>& b) {
+		return a.same_arena(b);
+	}
+
+	template<typename U>
+	friend bool operator!=(const pool_allocator& a, const pool_allocator<U>& b) {
+		return !(a == b);
+	}
+
+private:
+	template<typename U>
+	bool same_arena(const pool_allocator<U>& other) const {
+		return _arena == other._arena;
+	}
+
+	std::shared_ptr<memory_arena> _arena;
+	memory_pool* _pool; /**< Our chunk size's pool in _arena */
+};
+
+/**< Pre-sizes the pool behind an allocator; a no-op for any other allocator */
+template<typename Allocator>
+void reserve(Allocator&, std::size_t) {
+}
+
+template<typename T>
+void reserve(pool_allocator<T>& allocator, std::size_t n) {
+	allocator.reserve(n);
+}
+
+/**
+ * Lets ours release memory allocated through theirs, which is what moving
+ * nodes between containers needs. Returns false when that is not possible.
+ */
+template<typename Allocator>
+bool absorb(Allocator& ours, Allocator& theirs) {
+	return ours == theirs;
+}
+
+template<typename T>
+bool absorb(pool_allocator<T>& ours, pool_allocator<T>& theirs) {
+	return ours.absorb(theirs);
+}
+
+}
+}
+
+#endif /* POOL_ALLOCATOR_H_ */
@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+#include "pool_allocator.h"
+
+using data_structures::memory::memory_pool;
+using data_structures::memory::pool_allocator;
+
+class pool_allocator_test: public testing::Test {
+public:
+	pool_allocator<long> allocator;
+};
+
+TEST_F(pool_allocator_test, consecutiveAllocationsAreContiguous) {
+	long* a = allocator.allocate(1);
+	long* b = allocator.allocate(1);
+	long* c = allocator.allocate(1);
+	EXPECT_EQ(a + 1, b);
+	EXPECT_EQ(b + 1, c);
+	allocator.deallocate(a, 1);
+	allocator.deallocate(b, 1);
+	allocator.deallocate(c, 1);
+}
+
+TEST_F(pool_allocator_test, releasedChunksAreRecycled) {
+	long* a = allocator.allocate(1);
+	allocator.deallocate(a, 1);
+	long* b = allocator.allocate(1);
+	EXPECT_EQ(a, b);
+	allocator.deallocate(b, 1);
+}
+
+TEST_F(pool_allocator_test, copiesShareThePool) {
+	auto copy = allocator;
+	EXPECT_EQ(allocator, copy);
+	long* a = allocator.allocate(1);
+	copy.deallocate(a, 1);
+	EXPECT_EQ(a, allocator.allocate(1));
+}
+
+TEST_F(pool_allocator_test, containerCopiesGetTheirOwnPool) {
+	auto copy = allocator.select_on_container_copy_construction();
+	EXPECT_NE(allocator, copy);
+}
+
+TEST_F(pool_allocator_test, arraysBypassThePool) {
+	long* a = allocator.allocate(16);
+	for (int i = 0; i < 16; ++i)
+		a[i] = i;
+	allocator.deallocate(a, 16);
+}
+
+TEST_F(pool_allocator_test, reserveKeepsChunksContiguous) {
+	allocator.reserve(1000);
+	long* first = allocator.allocate(1);
+	long* last = first;
+	for (int i = 1; i < 1000; ++i) {
+		long* next = allocator.allocate(1);
+		EXPECT_EQ(last + 1, next);
+		last = next;
+	}
+}
+
+TEST_F(pool_allocator_test, chunksFitAFreeListLink) {
+	memory_pool pool(1, 1);
+	EXPECT_EQ(sizeof(void*), pool.chunk_size());
+}
+
+TEST_F(pool_allocator_test, absorbTakesOverAnotherPool) {
+	pool_allocator<long> other;
+	long* a = other.allocate(1);
+	EXPECT_TRUE(allocator.absorb(other));
+	allocator.deallocate(a, 1);
+	EXPECT_EQ(a, allocator.allocate(1));
+}
+
+TEST_F(pool_allocator_test, absorbRefusesSharedPools) {
+	pool_allocator<long> other;
+	auto copy = other;
+	EXPECT_FALSE(allocator.absorb(other));
+	EXPECT_TRUE(allocator.absorb(allocator));
+}
+
+TEST_F(pool_allocator_test, reboundCopiesShareTheArena) {
+	pool_allocator<char> rebound(allocator);
+	pool_allocator<long> back(rebound);
+	EXPECT_EQ(allocator, rebound);
+	EXPECT_EQ(allocator, back);
+
+	long* a = back.allocate(1);
+	allocator.deallocate(a, 1);
+	EXPECT_EQ(a, allocator.allocate(1));
+}
+
+TEST_F(pool_allocator_test, absorbRefusesArenasSharedByReboundCopies) {
+	pool_allocator<long> other;
+	pool_allocator<char> rebound(other);
+	EXPECT_FALSE(allocator.absorb(other));
+}
+
+TEST_F(pool_allocator_test, allocateShared) {
+	auto p = std::allocate_shared<long>(pool_allocator<long>(), 42);
+	EXPECT_EQ(42, *p);
+	std::weak_ptr<long> weak(p);
+	p.reset();
+	EXPECT_TRUE(weak.expired());
+}
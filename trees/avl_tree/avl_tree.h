@@ -2,100 +2,270 @@
 #define AVL_TREE_H_
 
 #include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <iterator>
+#include <memory>
 #include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
 #include "abstract/tree.h"
 #include "linked/doubly_linked_list/doubly_linked_list.h"
+#include "memory/pool_allocator/pool_allocator.h"
 
 namespace data_structures {
 namespace trees {
 
-using abstract::tree;
+using abstract::static_tree;
 using linked::doubly_linked_list;
 
-template<typename T, template<typename> class Container = doubly_linked_list>
-class avl_tree: public tree<T, Container> {
+template<typename T, template<typename...> class Container = doubly_linked_list,
+		typename Allocator = memory::pool_allocator<T>>
+class avl_tree: public static_tree<avl_tree<T, Container, Allocator>, T, Container> {
 	using size_type = std::size_t;
 
 private:
 	struct node {
-		node(const T& item) :
-				_height(1), _left(nullptr), _right(nullptr), _item(item) {
+		template<typename... Args>
+		node(node* parent, Args&&... args) :
+				_height(1), _size(1), _parent(parent), _left(nullptr), _right(nullptr),
+				_item(std::forward<Args>(args)...) {
 		}
 
 		size_type _height;
+		size_type _size;
+		node* _parent;
 		node* _left;
 		node* _right;
 		T _item;
 	};
 
-	bool has(node* root, const T& item) const {
-		if (root == nullptr)
-			return false;
-		if (root->_item > item)
-			return has(root->_left, item);
-		if (root->_item < item)
-			return has(root->_right, item);
-		return true;
-	}
+	/**
+	 * Traversal orders, as the first and last node of a subtree and the
+	 * steps between neighbours. Parent links make every step O(1) amortized
+	 * over a whole traversal, without any auxiliary stack.
+	 */
+	struct in_order_step {
+		static node* first(node* root) {
+			if (root != nullptr)
+				while (root->_left != nullptr)
+					root = root->_left;
+			return root;
+		}
 
-	std::intmax_t factor(node* root) const {
-		return (root == nullptr) ? 0 : height(root->_left) - height(root->_right);
-	}
+		static node* last(node* root) {
+			if (root != nullptr)
+				while (root->_right != nullptr)
+					root = root->_right;
+			return root;
+		}
 
-	std::intmax_t height(node* root) const {
-		return (root == nullptr) ? 0 : root->_height;
-	}
+		static node* next(node* root) {
+			if (root->_right != nullptr)
+				return first(root->_right);
+			while (root->_parent != nullptr && root == root->_parent->_right)
+				root = root->_parent;
+			return root->_parent;
+		}
 
-	node* insert(node* root, const T& item) {
-		// If we find a null root, we found the right spot.
-		if (root == nullptr)
-			return root = new node(item);
+		static node* prev(node* root) {
+			if (root->_left != nullptr)
+				return last(root->_left);
+			while (root->_parent != nullptr && root == root->_parent->_left)
+				root = root->_parent;
+			return root->_parent;
+		}
+	};
 
-		// If root's value is greater than inserted value, try to insert to the left.
-		else if (root->_item > item) {
-			root->_left = insert(root->_left, item);
+	struct pre_order_step {
+		static node* first(node* root) {
+			return root;
+		}
 
-			// If the factor of root unbalancing is 2, we have a left-left or left-right case.
-			if (factor(root) == 2) {
+		static node* last(node* root) {
+			// The deepest node reached preferring right children.
+			if (root != nullptr)
+				while (root->_right != nullptr || root->_left != nullptr)
+					root = (root->_right != nullptr) ? root->_right : root->_left;
+			return root;
+		}
 
-				// If the factor of the left node is -1, we have a left-right case.
-				if (factor(root->_left) == -1)
-					rotate_left(root->_left);
+		static node* next(node* root) {
+			if (root->_left != nullptr)
+				return root->_left;
+			if (root->_right != nullptr)
+				return root->_right;
+
+			// Climb until some ancestor has a right subtree we did not visit yet.
+			while (root->_parent != nullptr
+					&& (root == root->_parent->_right || root->_parent->_right == nullptr))
+				root = root->_parent;
+			return (root->_parent != nullptr) ? root->_parent->_right : nullptr;
+		}
 
-				// The tree is now guaranteedly a left-left case.
-				rotate_right(root);
-			}
+		static node* prev(node* root) {
+			node* parent = root->_parent;
+			if (parent == nullptr || root == parent->_left || parent->_left == nullptr)
+				return parent;
+			return last(parent->_left);
 		}
-		
-		// If root's value is lesser than inserted value, try to insert to the right.
-		else if (root->_item < item) {
-			root->_right = insert(root->_right, item);
+	};
 
-			// If the factor of root unbalancing is -2, we have a right-left or right-right case.
-			if (factor(root) == -2) {
+	struct post_order_step {
+		static node* first(node* root) {
+			// The deepest node reached preferring left children.
+			if (root != nullptr)
+				while (root->_left != nullptr || root->_right != nullptr)
+					root = (root->_left != nullptr) ? root->_left : root->_right;
+			return root;
+		}
 
-				// If the factor of the right node is 1, we have a right-left case.
-				if (factor(root->_right) == 1)
-					rotate_right(root->_right);
+		static node* last(node* root) {
+			return root;
+		}
 
-				// The tree is now guaranteedly a right-right case.
-				rotate_left(root);
-			}
+		static node* next(node* root) {
+			node* parent = root->_parent;
+			if (parent == nullptr || root == parent->_right || parent->_right == nullptr)
+				return parent;
+			return first(parent->_right);
+		}
+
+		static node* prev(node* root) {
+			if (root->_right != nullptr)
+				return root->_right;
+			if (root->_left != nullptr)
+				return root->_left;
+
+			// Climb until some ancestor has a left subtree we did not visit yet.
+			while (root->_parent != nullptr
+					&& (root == root->_parent->_left || root->_parent->_left == nullptr))
+				root = root->_parent;
+			return (root->_parent != nullptr) ? root->_parent->_left : nullptr;
+		}
+	};
+
+	/**
+	 * Items are kept ordered, so they can not be changed through iterators.
+	 * Going past either end yields end(), and end() steps back to the last
+	 * item, so rbegin() to rend() walks backwards with operator--.
+	 */
+	template<typename Step>
+	class iterator_base {
+	public:
+		using iterator_category = std::bidirectional_iterator_tag;
+		using value_type = T;
+		using difference_type = std::ptrdiff_t;
+		using pointer = const T*;
+		using reference = const T&;
+
+		iterator_base(node* ptr, const avl_tree* tree) :
+				_ptr(ptr), _tree(tree) {
+		}
 
-		// If root's value is equal to inserted value, we have an exception.
-		// TODO: find a better exception to throw.
-		} else throw std::exception();
+		iterator_base& operator++() {
+			if (_ptr == nullptr)
+				throw std::out_of_range("Iterating beyond tree end.");
+			_ptr = Step::next(_ptr);
+			return *this;
+		}
+
+		iterator_base operator++(int) {
+			iterator_base old = *this;
+			++(*this);
+			return old;
+		}
+
+		iterator_base& operator--() {
+			_ptr = (_ptr == nullptr) ? Step::last(_tree->_root) : Step::prev(_ptr);
+			return *this;
+		}
+
+		iterator_base operator--(int) {
+			iterator_base old = *this;
+			--(*this);
+			return old;
+		}
+
+		bool operator==(const iterator_base& other) const {
+			return _ptr == other._ptr;
+		}
+
+		bool operator!=(const iterator_base& other) const {
+			return _ptr != other._ptr;
+		}
+
+		const T& operator*() const {
+			return _ptr->_item;
+		}
+
+		const T* operator->() const {
+			return &(_ptr->_item);
+		}
+
+	private:
+		friend class avl_tree;
+
+		node* _ptr;
+		const avl_tree* _tree;
+	};
+
+	/**< A traversal order as something range-for can walk */
+	template<typename Iterator>
+	class view {
+	public:
+		view(Iterator begin, Iterator end) :
+				_begin(begin), _end(end) {
+		}
+
+		Iterator begin() const {
+			return _begin;
+		}
+
+		Iterator end() const {
+			return _end;
+		}
+
+	private:
+		Iterator _begin;
+		Iterator _end;
+	};
 
-		// Recalculate the node height according to the insertion.
+	/**
+	 * Upper bound for the height of any AVL tree whose size fits a size_type,
+	 * as the height never exceeds 1.44 * log2(n + 2).
+	 */
+	static constexpr size_type max_height = sizeof(size_type) * CHAR_BIT * 3 / 2;
+
+	std::intmax_t factor(node* root) const {
+		return (root == nullptr) ? 0 : height(root->_left) - height(root->_right);
+	}
+
+	std::intmax_t height(node* root) const {
+		return (root == nullptr) ? 0 : root->_height;
+	}
+
+	size_type size(node* root) const {
+		return (root == nullptr) ? 0 : root->_size;
+	}
+
+	void update(node* root) {
 		root->_height = std::max(height(root->_left), height(root->_right)) + 1;
-		return root;
+		root->_size = size(root->_left) + size(root->_right) + 1;
 	}
 
 	void rotate_left(node*& root) {
 		node* aux;
 		aux = root->_right;
 		root->_right = aux->_left;
+		if (aux->_left != nullptr)
+			aux->_left->_parent = root;
 		aux->_left = root;
+		aux->_parent = root->_parent;
+		root->_parent = aux;
+		update(root);
+		update(aux);
 		root = aux;
 	}
 
@@ -103,99 +273,164 @@ private:
 		node* aux;
 		aux = root->_left;
 		root->_left = aux->_right;
+		if (aux->_right != nullptr)
+			aux->_right->_parent = root;
 		aux->_right = root;
+		aux->_parent = root->_parent;
+		root->_parent = aux;
+		update(root);
+		update(aux);
 		root = aux;
 	}
 
-	node* remove(node* root, const T& item) {
-		// If we find a nullptr, the item does not exist in this tree.
-		if (root == nullptr)
-			throw std::exception();
+	void rebalance(node*& root) {
+		update(root);
 
-		// The same of insertion works here. Find where the item must be, rebalance if needed.
-		else if (root->_item > item) {
-			root->_left = remove(root->_left, item);
-			if (factor(root) == 2) {
-				if (factor(root->_left) == -1)
-					rotate_left(root->_left);
-				rotate_right(root);
-			}
-		} else if (root->_item < item) {
-			root->_right = remove(root->_right, item);
-		
-			if (factor(root) == -2) {
-				if (factor(root->_right) == 1)
-					rotate_right(root->_right);
-				rotate_left(root);
-			}
+		// If the factor of root unbalancing is 2, we have a left-left or left-right case.
+		if (factor(root) == 2) {
+
+			// If the factor of the left node is -1, we have a left-right case.
+			if (factor(root->_left) == -1)
+				rotate_left(root->_left);
+
+			// The tree is now guaranteedly a left-left case.
+			rotate_right(root);
 		}
-		
-		// If root's value is equal to removed value, we found the node to remove.
-		else {
 
-			// Leaf case: just delete the actual node.
-			if (root->_left == nullptr && root->_right == nullptr) {
-				delete root;
-				return nullptr;
-			}
+		// If the factor of root unbalancing is -2, we have a right-left or right-right case.
+		else if (factor(root) == -2) {
 
-			// If there is only right child, replace the to-be-deleted node and delete it.
-			if (root->_left == nullptr) {
-				node* aux = root->_right;
-				delete root;
-				return aux;
-			}
+			// If the factor of the right node is 1, we have a right-left case.
+			if (factor(root->_right) == 1)
+				rotate_right(root->_right);
 
-			// If there is only left child, replace the to-be-deleted node and delete it.
-			if (root->_right == nullptr) {
-				node* aux = root->_left;
-				delete root;
-				return aux;
-			}
+			// The tree is now guaranteedly a right-right case.
+			rotate_left(root);
+		}
+	}
 
-			// If there are both children, find the immediately next value, swap and retry to remove.
-			node* aux = root->_right;
-			while (aux->_left != nullptr)
-				aux = aux->_left;
-			std::swap(root->_item, aux->_item);
-			root->_right = remove(root->_right, item);
+	void retrace(node** path[], size_type depth) {
+		// Walk back up the links we came through, deepest first. Once a subtree
+		// keeps the height it had, nothing above it can change anymore.
+		while (depth > 0) {
+			node*& root = *path[--depth];
+			size_type before = root->_height;
+			rebalance(root);
+			if (root->_height == before)
+				break;
 		}
+	}
 
-		// Recalculate the node height according to the removal.
-		root->_height = std::max(height(root->_left), height(root->_right)) + 1;
-		return root;
+	template<typename Range>
+	static Container<T> collect(const Range& range) {
+		Container<T> container;
+		for (const T& item : range)
+			container.push_back(item);
+		return container;
 	}
 
-	void in_order(node* root, Container<T>& container) const {
-		if (root != nullptr) {
-			in_order(root->_left, container);
-			container.push_back(root->_item);
-			in_order(root->_right, container);
-		}
+	/**< Calls visit on item, telling whether to go on; visitors returning void never stop */
+	template<typename Visit>
+	static bool proceed(Visit& visit, const T& item, std::true_type) {
+		visit(item);
+		return true;
 	}
 
-	void pre_order(node* root, Container<T>& container) const {
-		if (root != nullptr) {
-			container.push_back(root->_item);
-			pre_order(root->_left, container);
-			pre_order(root->_right, container);
+	template<typename Visit>
+	static bool proceed(Visit& visit, const T& item, std::false_type) {
+		return visit(item);
+	}
+
+	/**< Streams the items from first on in Step order while within(item) holds */
+	template<typename Step, typename Visit, typename Within>
+	static bool visit_from(node* first, Visit& visit, Within within) {
+		using never_stops = std::is_void<decltype(visit(std::declval<const T&>()))>;
+		for (node* p = first; p != nullptr && within(p->_item); p = Step::next(p))
+			if (!proceed(visit, p->_item, never_stops()))
+				return false;
+		return true;
+	}
+
+	template<typename Step, typename Visit>
+	bool visit_all(Visit& visit) const {
+		return visit_from<Step>(Step::first(_root), visit, [](const T&) {
+			return true;
+		});
+	}
+
+	/**
+	 * Unlinks the node at the far end of side, the leftmost for &node::_left,
+	 * and returns its item. That node has no child on side, so the other one
+	 * takes its place.
+	 */
+	T pop_extreme(node* node::*side) {
+		if (_root == nullptr)
+			throw std::out_of_range("Empty tree.");
+
+		node** path[max_height];
+		size_type depth = 0;
+		node** link = &_root;
+		while ((*link)->*side != nullptr) {
+			path[depth++] = link;
+			link = &((*link)->*side);
 		}
+
+		node* extreme = *link;
+		node* child = (side == &node::_left) ? extreme->_right : extreme->_left;
+		if (child != nullptr)
+			child->_parent = extreme->_parent;
+		*link = child;
+
+		T item = std::move(extreme->_item);
+		destroy_node(extreme);
+		--_size;
+
+		for (size_type i = 0; i < depth; ++i)
+			--(*path[i])->_size;
+		retrace(path, depth);
+		return item;
 	}
 
-	void post_order(node* root, Container<T>& container) const {
-		if (root != nullptr) {
-			post_order(root->_left, container);
-			post_order(root->_right, container);
-			container.push_back(root->_item);
+	/**
+	 * Copies the subtree at source node by node in pre-order, keeping heights
+	 * and sizes. Both trees are walked in step through parent links, so no
+	 * stack is needed: a copy lacking a child the source has is where the
+	 * walk goes next, and once both children are there it climbs.
+	 */
+	node* clone(const node* source) {
+		if (source == nullptr)
+			return nullptr;
+
+		node* root = copy_node(nullptr, source);
+		try {
+			node* copy = root;
+			const node* from = source;
+			while (true) {
+				if (from->_left != nullptr && copy->_left == nullptr) {
+					from = from->_left;
+					copy = copy->_left = copy_node(copy, from);
+				} else if (from->_right != nullptr && copy->_right == nullptr) {
+					from = from->_right;
+					copy = copy->_right = copy_node(copy, from);
+				} else if (from != source) {
+					from = from->_parent;
+					copy = copy->_parent;
+				} else {
+					break;
+				}
+			}
+		} catch (...) {
+			recursive_delete(root);
+			throw;
 		}
+		return root;
 	}
 
-	node* recursive_copy(node* other_root) {
-		// To recursively copy, create a new node, recursively copy it's left and right child, then return it to be attached.
-		node* aux = new node(other_root->_item);
-		aux->_left = recursive_copy(other_root->_left);
-		aux->_right = recursive_copy(other_root->_right);
-		return aux;
+	node* copy_node(node* parent, const node* source) {
+		node* p = create_node(parent, source->_item);
+		p->_height = source->_height;
+		p->_size = source->_size;
+		return p;
 	}
 
 	void recursive_delete(node* root) {
@@ -203,19 +438,137 @@ private:
 		if (root != nullptr) {
 			recursive_delete(root->_left);
 			recursive_delete(root->_right);
-			delete root;
+			destroy_node(root);
+		}
+	}
+
+	/**
+	 * Builds a perfectly balanced subtree out of the next n items of a sorted
+	 * sequence, consuming them in order. The left half gets the extra item,
+	 * so sibling heights never differ by more than one.
+	 */
+	template<typename Iterator>
+	node* build(Iterator& it, size_type n) {
+		if (n == 0)
+			return nullptr;
+
+		node* left = build(it, n / 2);
+		node* root;
+		try {
+			root = create_node(nullptr, *it);
+		} catch (...) {
+			recursive_delete(left);
+			throw;
+		}
+		++it;
+
+		root->_left = left;
+		if (left != nullptr)
+			left->_parent = root;
+
+		try {
+			root->_right = build(it, n - n / 2 - 1);
+		} catch (...) {
+			recursive_delete(root);
+			throw;
+		}
+		if (root->_right != nullptr)
+			root->_right->_parent = root;
+
+		update(root);
+		return root;
+	}
+
+	/**< Replaces the whole tree by the n items of a strictly increasing sequence */
+	template<typename Iterator>
+	void rebuild(Iterator first, size_type n) {
+		memory::reserve(_alloc, n);
+		node* root = build(first, n);
+		recursive_delete(_root);
+		_root = root;
+		_size = n;
+	}
+
+	/**
+	 * Finds the empty link where item belongs, remembering the way down in
+	 * path. Throws if item is already in the tree.
+	 */
+	node** find_link(const T& item, node** path[], size_type& depth) {
+		node** link = &_root;
+		while (*link != nullptr) {
+			path[depth++] = link;
+			if ((*link)->_item > item)
+				link = &(*link)->_left;
+			else if ((*link)->_item < item)
+				link = &(*link)->_right;
+
+			// If the value is already there, we have an exception.
+			// TODO: find a better exception to throw.
+			else throw std::exception();
+		}
+		return link;
+	}
+
+	/**< Hangs fresh from the link find_link returned, then rebalances the way up */
+	void attach(node** link, node* fresh, node** path[], size_type depth) {
+		fresh->_parent = depth > 0 ? *path[depth - 1] : nullptr;
+		*link = fresh;
+		++_size;
+
+		// Every subtree on the way down grew by one, even where heights did not.
+		for (size_type i = 0; i < depth; ++i)
+			++(*path[i])->_size;
+		retrace(path, depth);
+	}
+
+	template<typename... Args>
+	node* create_node(Args&&... args) {
+		node* p = node_traits::allocate(_alloc, 1);
+		try {
+			node_traits::construct(_alloc, p, std::forward<Args>(args)...);
+		} catch (...) {
+			node_traits::deallocate(_alloc, p, 1);
+			throw;
 		}
+		return p;
 	}
 
-	using self = avl_tree<T>;
+	void destroy_node(node* p) {
+		node_traits::destroy(_alloc, p);
+		node_traits::deallocate(_alloc, p, 1);
+	}
+
+	using self = avl_tree<T, Container, Allocator>;
+	using node_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<node>;
+	using node_traits = std::allocator_traits<node_allocator>;
 
 public:
+	using allocator_type = Allocator;
+
 	avl_tree() :
 			_size(0), _root(nullptr) {
 	}
 
-	avl_tree(const self& other) {
-		_root = recursive_copy(other.root);
+	/**< Builds the tree out of any range, in O(n) when it is already sorted */
+	template<typename Iterator>
+	avl_tree(Iterator first, Iterator last) :
+			avl_tree() {
+		insert_range(first, last);
+	}
+
+	/**< Clones other in O(n), taking all the nodes out of a single pool reservation */
+	avl_tree(const self& other) :
+			_alloc(node_traits::select_on_container_copy_construction(other._alloc)),
+			_size(0), _root(nullptr) {
+		memory::reserve(_alloc, other._size);
+		_root = clone(other._root);
+		_size = other._size;
+	}
+
+	/**< Takes over the nodes of other in O(1), leaving it empty */
+	avl_tree(self&& other) :
+			avl_tree() {
+		swap(*this, other);
 	}
 
 	~avl_tree() {
@@ -223,42 +576,367 @@ public:
 	}
 
 	bool has(const T& item) const {
-		return has(_root, item);
+		node* root = _root;
+		while (root != nullptr) {
+			if (root->_item > item)
+				root = root->_left;
+			else if (root->_item < item)
+				root = root->_right;
+			else
+				return true;
+		}
+		return false;
 	}
 
 	size_type size() const {
 		return _size;
 	}
 
+	/**< Smallest and greatest items, down one side of the tree in O(log n) */
+	const T& min() const {
+		if (_root == nullptr)
+			throw std::out_of_range("Empty tree.");
+		return in_order_step::first(_root)->_item;
+	}
+
+	const T& max() const {
+		if (_root == nullptr)
+			throw std::out_of_range("Empty tree.");
+		return in_order_step::last(_root)->_item;
+	}
+
+	/**< Removes and returns the smallest or greatest item, in O(log n) */
+	T pop_min() {
+		return pop_extreme(&node::_left);
+	}
+
+	T pop_max() {
+		return pop_extreme(&node::_right);
+	}
+
 	void insert(const T& item) {
-		_root = insert(_root, item);
-		++_size;
+		node** path[max_height];
+		size_type depth = 0;
+		node** link = find_link(item, path, depth);
+		attach(link, create_node(nullptr, item), path, depth);
+	}
+
+	void insert(T&& item) {
+		node** path[max_height];
+		size_type depth = 0;
+		node** link = find_link(item, path, depth);
+		attach(link, create_node(nullptr, std::move(item)), path, depth);
+	}
+
+	/**< Builds the item in place out of args first, since it takes an item to find its place */
+	template<typename... Args>
+	void emplace(Args&&... args) {
+		node* fresh = create_node(nullptr, std::forward<Args>(args)...);
+		node** path[max_height];
+		size_type depth = 0;
+		node** link;
+		try {
+			link = find_link(fresh->_item, path, depth);
+		} catch (...) {
+			destroy_node(fresh);
+			throw;
+		}
+		attach(link, fresh, path, depth);
 	}
 
 	void remove(const T& item) {
-		_root = remove(_root, item);
+		node** path[max_height];
+		size_type depth = 0;
+
+		node** link = &_root;
+		while (true) {
+			// If we find a nullptr, the item does not exist in this tree.
+			if (*link == nullptr)
+				throw std::exception();
+
+			if ((*link)->_item > item) {
+				path[depth++] = link;
+				link = &(*link)->_left;
+			} else if ((*link)->_item < item) {
+				path[depth++] = link;
+				link = &(*link)->_right;
+			} else {
+				break;
+			}
+		}
+
+		node* root = *link;
+		if (root->_left == nullptr || root->_right == nullptr) {
+			// With at most one child, that child takes the place of the removed node.
+			node* child = (root->_left != nullptr) ? root->_left : root->_right;
+			if (child != nullptr)
+				child->_parent = root->_parent;
+			*link = child;
+		} else {
+			// With both children, the immediately next node is unlinked from
+			// the right subtree and takes the place of the removed node.
+			size_type index = depth;
+			path[depth++] = link;
+
+			node** next = &root->_right;
+			while ((*next)->_left != nullptr) {
+				path[depth++] = next;
+				next = &(*next)->_left;
+			}
+
+			node* aux = *next;
+			*next = aux->_right;
+			if (aux->_right != nullptr)
+				aux->_right->_parent = (aux->_parent == root) ? aux : aux->_parent;
+			aux->_left = root->_left;
+			aux->_left->_parent = aux;
+			aux->_right = root->_right;
+			if (aux->_right != nullptr)
+				aux->_right->_parent = aux;
+			aux->_parent = root->_parent;
+			aux->_height = root->_height;
+			aux->_size = root->_size;
+			*link = aux;
+
+			// The way down went through the removed node's right link.
+			if (depth > index + 1)
+				path[index + 1] = &aux->_right;
+		}
+
+		destroy_node(root);
 		--_size;
+
+		for (size_type i = 0; i < depth; ++i)
+			--(*path[i])->_size;
+		retrace(path, depth);
 	}
 
 	Container<T> in_order() const {
-		Container<T> container;
-		in_order(_root, container);
-		return container;
+		return collect(*this);
 	}
 
 	Container<T> pre_order() const {
-		Container<T> container;
-		pre_order(_root, container);
-		return container;
+		return collect(pre_order_view());
 	}
 
 	Container<T> post_order() const {
-		Container<T> container;
-		post_order(_root, container);
-		return container;
+		return collect(post_order_view());
+	}
+
+	/**< In-order iterators, walking the tree in place */
+	using iterator = iterator_base<in_order_step>;
+	using const_iterator = iterator;
+
+	iterator begin() const {
+		return {in_order_step::first(_root), this};
+	}
+
+	iterator end() const {
+		return {nullptr, this};
+	}
+
+	iterator rbegin() const {
+		return {in_order_step::last(_root), this};
+	}
+
+	iterator rend() const {
+		return {nullptr, this};
+	}
+
+	/**< The k-th smallest item, counting from zero, in O(log n) like every query below */
+	T select(size_type k) const {
+		if (k >= _size)
+			throw std::out_of_range("Out of range access.");
+
+		node* root = _root;
+		while (k != size(root->_left)) {
+			if (k < size(root->_left)) {
+				root = root->_left;
+			} else {
+				k -= size(root->_left) + 1;
+				root = root->_right;
+			}
+		}
+		return root->_item;
+	}
+
+	/**< How many items are smaller than item */
+	size_type rank(const T& item) const {
+		size_type smaller = 0;
+		node* root = _root;
+		while (root != nullptr) {
+			if (root->_item < item) {
+				smaller += size(root->_left) + 1;
+				root = root->_right;
+			} else {
+				root = root->_left;
+			}
+		}
+		return smaller;
+	}
+
+	/**< How many items lie within [low, high] */
+	size_type count_range(const T& low, const T& high) const {
+		if (low > high)
+			return 0;
+		return rank(high) + (has(high) ? 1 : 0) - rank(low);
+	}
+
+	/**< First item not smaller than item */
+	iterator lower_bound(const T& item) const {
+		node* found = nullptr;
+		node* root = _root;
+		while (root != nullptr) {
+			if (root->_item < item) {
+				root = root->_right;
+			} else {
+				found = root;
+				root = root->_left;
+			}
+		}
+		return {found, this};
+	}
+
+	/**< First item greater than item */
+	iterator upper_bound(const T& item) const {
+		node* found = nullptr;
+		node* root = _root;
+		while (root != nullptr) {
+			if (root->_item > item) {
+				found = root;
+				root = root->_left;
+			} else {
+				root = root->_right;
+			}
+		}
+		return {found, this};
+	}
+
+	/**< Lazy pre-order and post-order traversals, for range-for */
+	using pre_order_iterator = iterator_base<pre_order_step>;
+	using post_order_iterator = iterator_base<post_order_step>;
+
+	view<pre_order_iterator> pre_order_view() const {
+		return {{pre_order_step::first(_root), this}, {nullptr, this}};
+	}
+
+	view<post_order_iterator> post_order_view() const {
+		return {{post_order_step::first(_root), this}, {nullptr, this}};
+	}
+
+	/**
+	 * Streams every item to visit in the given order, in place and without
+	 * allocating. A visitor returning bool stops the walk by returning
+	 * false; the result tells whether the walk got to the end.
+	 */
+	template<typename Visit>
+	bool for_each_in_order(Visit&& visit) const {
+		return visit_all<in_order_step>(visit);
+	}
+
+	template<typename Visit>
+	bool for_each_pre_order(Visit&& visit) const {
+		return visit_all<pre_order_step>(visit);
+	}
+
+	template<typename Visit>
+	bool for_each_post_order(Visit&& visit) const {
+		return visit_all<post_order_step>(visit);
+	}
+
+	/**< Streams the items within [low, high] in order, as for_each_in_order(), in O(log n + k) */
+	template<typename Visit>
+	bool for_each_in_range(const T& low, const T& high, Visit&& visit) const {
+		return visit_from<in_order_step>(lower_bound(low)._ptr, visit, [&high](const T& item) {
+			return !(high < item);
+		});
+	}
+
+	self& operator=(const self& rhs) {
+		self copy(rhs);
+		swap(*this, copy);
+		return *this;
+	}
+
+	self& operator=(self&& rhs) {
+		swap(*this, rhs);
+		return *this;
+	}
+
+	friend void swap(self& a, self& b) {
+		using std::swap;
+
+		swap(a._alloc, b._alloc);
+		swap(a._size, b._size);
+		swap(a._root, b._root);
+	}
+
+	/**
+	 * Replaces the contents by a strictly increasing range in O(n), building
+	 * a perfectly balanced tree with a single pool reservation. Throws
+	 * std::invalid_argument, leaving the tree untouched, if the range is not
+	 * strictly increasing.
+	 */
+	template<typename ForwardIterator>
+	void assign_sorted(ForwardIterator first, ForwardIterator last) {
+		size_type n = 0;
+		ForwardIterator prev = first;
+		for (ForwardIterator it = first; it != last; prev = it, ++it, ++n)
+			if (n > 0 && !(*prev < *it))
+				throw std::invalid_argument("Range is not strictly increasing.");
+
+		rebuild(first, n);
+	}
+
+	/**
+	 * Inserts every item of a range in any order. A handful of items is
+	 * inserted one by one; larger batches are sorted and merged with the
+	 * current items into a rebuilt tree, in O(n + m log m). Throws
+	 * std::invalid_argument, leaving the tree untouched, if an item is
+	 * repeated or already present.
+	 */
+	template<typename Iterator>
+	void insert_range(Iterator first, Iterator last) {
+		std::vector<T> items(first, last);
+		if (!std::is_sorted(items.begin(), items.end()))
+			std::sort(items.begin(), items.end());
+		if (std::adjacent_find(items.begin(), items.end(),
+				[](const T& a, const T& b) { return !(a < b); }) != items.end())
+			throw std::invalid_argument("Repeated item in range.");
+
+		// Individual inserts win while m of them, each as deep as the final
+		// tree, cost less than rebuilding all n + m items.
+		const size_type total = _size + items.size();
+		size_type depth = 0;
+		for (size_type n = total; n > 0; n >>= 1)
+			++depth;
+		if (items.size() * depth < total) {
+			for (const T& item : items)
+				if (has(item))
+					throw std::invalid_argument("Item already in tree.");
+			for (const T& item : items)
+				insert(item);
+			return;
+		}
+
+		std::vector<T> merged;
+		merged.reserve(_size + items.size());
+		auto it = begin();
+		for (T& item : items) {
+			for (; it != end() && *it < item; ++it)
+				merged.push_back(*it);
+			if (it != end() && !(item < *it))
+				throw std::invalid_argument("Item already in tree.");
+			merged.push_back(std::move(item));
+		}
+		for (; it != end(); ++it)
+			merged.push_back(*it);
+
+		rebuild(std::make_move_iterator(merged.begin()), merged.size());
 	}
 
 private:
+	node_allocator _alloc;
 	size_type _size;
 	node* _root;
 };
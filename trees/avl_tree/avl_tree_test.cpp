@@ -1,8 +1,61 @@
 #include <gtest/gtest.h>
+#include <iterator>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
 #include "avl_tree.h"
 
 using data_structures::trees::avl_tree;
 
+namespace {
+
+/**< Counts how often it gets copied and moved */
+struct tracked {
+	tracked(int value = 0) :
+			value(value) {
+	}
+
+	tracked(const tracked& other) :
+			value(other.value) {
+		++copies;
+	}
+
+	tracked(tracked&& other) :
+			value(other.value) {
+		++moves;
+	}
+
+	tracked& operator=(const tracked& other) {
+		value = other.value;
+		++copies;
+		return *this;
+	}
+
+	tracked& operator=(tracked&& other) {
+		value = other.value;
+		++moves;
+		return *this;
+	}
+
+	bool operator<(const tracked& other) const {
+		return value < other.value;
+	}
+
+	bool operator>(const tracked& other) const {
+		return value > other.value;
+	}
+
+	int value;
+	static int copies;
+	static int moves;
+};
+
+int tracked::copies = 0;
+int tracked::moves = 0;
+
+}
+
 class avl_tree_test: public testing::Test {
 public:
 	avl_tree<int> tree;
@@ -298,4 +351,477 @@ TEST_F(avl_tree_test, copyConstructIsCreatedCorrect) {
 	tree.insert(42);
 	tree.insert(13);
 	tree.insert(1963);
+
+	avl_tree<int> copy(tree);
+	EXPECT_EQ(3, copy.size());
+	EXPECT_EQ(tree.pre_order(), copy.pre_order());
+
+	copy.insert(7);
+	tree.remove(42);
+	EXPECT_TRUE(copy.has(42));
+	EXPECT_FALSE(tree.has(7));
+}
+
+TEST_F(avl_tree_test, copyOfEmptyTreeIsEmpty) {
+	avl_tree<int> copy(tree);
+	EXPECT_EQ(0, copy.size());
+	EXPECT_EQ(copy.end(), copy.begin());
+	copy.insert(1);
+	EXPECT_EQ(1, copy.size());
+}
+
+TEST_F(avl_tree_test, copyKeepsShapeHeightsAndSizes) {
+	std::mt19937 random(11);
+	for (int i = 0; i < 2000; ++i) {
+		int key = random() % 10000;
+		if (!tree.has(key))
+			tree.insert(key);
+	}
+
+	const avl_tree<int> copy(tree);
+	EXPECT_EQ(tree.size(), copy.size());
+	EXPECT_EQ(tree.pre_order(), copy.pre_order());
+	EXPECT_EQ(tree.post_order(), copy.post_order());
+	for (std::size_t k = 0; k < copy.size(); k += 37)
+		EXPECT_EQ(tree.select(k), copy.select(k));
+
+	// Rebalancing after further changes relies on the copied heights.
+	avl_tree<int> changed(copy);
+	for (int key = 10000; key < 12000; ++key) {
+		changed.insert(key);
+		tree.insert(key);
+	}
+	EXPECT_EQ(tree.pre_order(), changed.pre_order());
+	EXPECT_EQ(tree.rank(11000), changed.rank(11000));
+}
+
+TEST_F(avl_tree_test, copyAssignmentReplacesContents) {
+	for (int key : { 42, 13, 1963 })
+		tree.insert(key);
+
+	avl_tree<int> other;
+	other.insert(5);
+	other = tree;
+	EXPECT_EQ(tree.in_order(), other.in_order());
+	EXPECT_FALSE(other.has(5));
+
+	other = other;
+	EXPECT_EQ(3, other.size());
+}
+
+TEST_F(avl_tree_test, moveLeavesSourceEmpty) {
+	for (int key : { 42, 13, 1963 })
+		tree.insert(key);
+
+	avl_tree<int> moved(std::move(tree));
+	EXPECT_EQ(3, moved.size());
+	EXPECT_EQ(0, tree.size());
+	EXPECT_EQ(tree.end(), tree.begin());
+
+	tree = std::move(moved);
+	EXPECT_EQ(3, tree.size());
+	EXPECT_EQ(13, tree.min());
+	tree.insert(1);
+	EXPECT_EQ(1, tree.pop_min());
+}
+
+TEST_F(avl_tree_test, copyHoldsOwningItems) {
+	avl_tree<std::string> words;
+	for (const char* word : { "pear", "apple", "fig", "kiwi" })
+		words.insert(word);
+
+	avl_tree<std::string> copy(words);
+	words.remove("fig");
+	EXPECT_TRUE(copy.has("fig"));
+	EXPECT_EQ("apple", copy.min());
+}
+
+TEST_F(avl_tree_test, sequentialInsertionStaysBalanced) {
+	for (int i = 1; i <= 7; ++i)
+		tree.insert(i);
+
+	/**
+	 * Tree would be:
+	 *      4
+	 *    /   \
+	 *   2     6
+	 *  / \   / \
+	 * 1   3 5   7
+	 */
+
+	auto pre_order = tree.pre_order();
+	EXPECT_EQ(pre_order, std::initializer_list<int>({ 4, 2, 1, 3, 6, 5, 7 }));
+}
+
+TEST_F(avl_tree_test, randomOperationsMatchStdSet) {
+	std::set<int> reference;
+	std::mt19937 random(42);
+	std::uniform_int_distribution<int> keys(0, 499);
+
+	for (int i = 0; i < 5000; ++i) {
+		int key = keys(random);
+		if (reference.count(key)) {
+			tree.remove(key);
+			reference.erase(key);
+		} else {
+			tree.insert(key);
+			reference.insert(key);
+		}
+		ASSERT_EQ(reference.size(), tree.size());
+	}
+
+	auto in_order = tree.in_order();
+	auto expected = reference.begin();
+	for (auto key : in_order)
+		EXPECT_EQ(*expected++, key);
+	for (int key = 0; key < 500; ++key)
+		EXPECT_EQ(reference.count(key) == 1, tree.has(key));
+}
+
+TEST_F(avl_tree_test, rangeForIsInOrder) {
+	for (int key : { 42, 13, 1963, 7, 99 })
+		tree.insert(key);
+
+	std::vector<int> keys;
+	for (int key : tree)
+		keys.push_back(key);
+	EXPECT_EQ(std::vector<int>({ 7, 13, 42, 99, 1963 }), keys);
+}
+
+TEST_F(avl_tree_test, backwardIteratorRegress) {
+	for (int key : { 42, 13, 1963 })
+		tree.insert(key);
+
+	auto it = tree.rbegin();
+	EXPECT_EQ(1963, *it);
+	--it;
+	EXPECT_EQ(42, *it);
+	--it;
+	EXPECT_EQ(13, *it);
+	--it;
+	EXPECT_EQ(tree.rend(), it);
+	EXPECT_EQ(1963, *--tree.end());
+}
+
+TEST_F(avl_tree_test, emptyTreeIteratesNothing) {
+	EXPECT_EQ(tree.end(), tree.begin());
+	EXPECT_EQ(tree.pre_order_view().end(), tree.pre_order_view().begin());
+	EXPECT_EQ(tree.post_order_view().end(), tree.post_order_view().begin());
+}
+
+TEST_F(avl_tree_test, lazyViewsFollowTraversalOrders) {
+	for (int i = 1; i <= 7; ++i)
+		tree.insert(i);
+
+	std::vector<int> pre_order, post_order;
+	for (int key : tree.pre_order_view())
+		pre_order.push_back(key);
+	for (int key : tree.post_order_view())
+		post_order.push_back(key);
+
+	EXPECT_EQ(std::vector<int>({ 4, 2, 1, 3, 6, 5, 7 }), pre_order);
+	EXPECT_EQ(std::vector<int>({ 1, 3, 2, 5, 7, 6, 4 }), post_order);
+
+	auto it = tree.post_order_view().end();
+	EXPECT_EQ(4, *--it);
+	EXPECT_EQ(6, *--it);
+	EXPECT_EQ(7, *--it);
+}
+
+TEST_F(avl_tree_test, selectFindsKthSmallest) {
+	for (int key : { 42, 13, 1963, 7, 99 })
+		tree.insert(key);
+
+	EXPECT_EQ(7, tree.select(0));
+	EXPECT_EQ(42, tree.select(2));
+	EXPECT_EQ(1963, tree.select(4));
+	EXPECT_THROW(tree.select(5), std::out_of_range);
+}
+
+TEST_F(avl_tree_test, rankCountsSmallerItems) {
+	for (int key : { 42, 13, 1963 })
+		tree.insert(key);
+
+	EXPECT_EQ(0, tree.rank(13));
+	EXPECT_EQ(1, tree.rank(42));
+	EXPECT_EQ(2, tree.rank(43));
+	EXPECT_EQ(3, tree.rank(2000));
+}
+
+TEST_F(avl_tree_test, countRangeIsInclusive) {
+	for (int key : { 42, 13, 1963, 7, 99 })
+		tree.insert(key);
+
+	EXPECT_EQ(3, tree.count_range(13, 99));
+	EXPECT_EQ(2, tree.count_range(8, 50));
+	EXPECT_EQ(0, tree.count_range(100, 1000));
+	EXPECT_EQ(0, tree.count_range(99, 13));
+}
+
+TEST_F(avl_tree_test, boundsFindNeighbours) {
+	for (int key : { 42, 13, 1963 })
+		tree.insert(key);
+
+	EXPECT_EQ(42, *tree.lower_bound(42));
+	EXPECT_EQ(1963, *tree.upper_bound(42));
+	EXPECT_EQ(13, *tree.lower_bound(0));
+	EXPECT_EQ(tree.end(), tree.lower_bound(2000));
+	EXPECT_EQ(tree.end(), tree.upper_bound(1963));
+}
+
+TEST_F(avl_tree_test, orderStatisticsSurviveRandomOperations) {
+	std::set<int> reference;
+	std::mt19937 random(7);
+	std::uniform_int_distribution<int> keys(0, 299);
+
+	for (int i = 0; i < 3000; ++i) {
+		int key = keys(random);
+		if (reference.count(key)) {
+			tree.remove(key);
+			reference.erase(key);
+		} else {
+			tree.insert(key);
+			reference.insert(key);
+		}
+	}
+
+	std::size_t k = 0;
+	for (int key : reference) {
+		ASSERT_EQ(key, tree.select(k));
+		ASSERT_EQ(k, tree.rank(key));
+		++k;
+	}
+	EXPECT_EQ(std::distance(reference.lower_bound(50), reference.upper_bound(150)),
+			tree.count_range(50, 150));
+}
+
+TEST_F(avl_tree_test, assignSortedBuildsBalancedTree) {
+	std::vector<int> keys = { 1, 2, 3, 4, 5, 6, 7 };
+	tree.insert(42);
+	tree.assign_sorted(keys.begin(), keys.end());
+
+	EXPECT_EQ(7, tree.size());
+	EXPECT_FALSE(tree.has(42));
+	EXPECT_EQ(tree.pre_order(), std::initializer_list<int>({ 4, 2, 1, 3, 6, 5, 7 }));
+
+	tree.insert(8);
+	tree.remove(1);
+	EXPECT_EQ(tree.in_order(), std::initializer_list<int>({ 2, 3, 4, 5, 6, 7, 8 }));
+	EXPECT_EQ(3, tree.select(1));
+}
+
+TEST_F(avl_tree_test, assignSortedRejectsUnsortedInput) {
+	std::vector<int> keys = { 1, 3, 2 };
+	tree.insert(42);
+	EXPECT_THROW(tree.assign_sorted(keys.begin(), keys.end()), std::invalid_argument);
+	EXPECT_EQ(1, tree.size());
+	EXPECT_TRUE(tree.has(42));
+}
+
+TEST_F(avl_tree_test, constructFromRange) {
+	std::vector<int> keys = { 42, 13, 1963, 7 };
+	avl_tree<int> other(keys.begin(), keys.end());
+	EXPECT_EQ(4, other.size());
+	EXPECT_EQ(other.in_order(), std::initializer_list<int>({ 7, 13, 42, 1963 }));
+}
+
+TEST_F(avl_tree_test, insertRangeMergesIntoTree) {
+	for (int key : { 10, 20, 30 })
+		tree.insert(key);
+
+	std::vector<int> keys = { 25, 5, 35, 15 };
+	tree.insert_range(keys.begin(), keys.end());
+	EXPECT_EQ(7, tree.size());
+	EXPECT_EQ(tree.in_order(), std::initializer_list<int>({ 5, 10, 15, 20, 25, 30, 35 }));
+}
+
+TEST_F(avl_tree_test, insertRangeOfPresentItemThrows) {
+	for (int key : { 10, 20, 30 })
+		tree.insert(key);
+
+	std::vector<int> keys = { 25, 20 };
+	EXPECT_THROW(tree.insert_range(keys.begin(), keys.end()), std::invalid_argument);
+	EXPECT_EQ(3, tree.size());
+	EXPECT_FALSE(tree.has(25));
+
+	std::vector<int> repeated = { 1, 1 };
+	EXPECT_THROW(tree.insert_range(repeated.begin(), repeated.end()), std::invalid_argument);
+}
+
+TEST_F(avl_tree_test, insertRangeOfFewItemsIntoLargeTree) {
+	std::vector<int> keys;
+	for (int i = 0; i < 1000; i += 2)
+		keys.push_back(i);
+	tree.assign_sorted(keys.begin(), keys.end());
+
+	std::vector<int> few = { 501, 3 };
+	tree.insert_range(few.begin(), few.end());
+	EXPECT_EQ(502, tree.size());
+	EXPECT_EQ(2, tree.rank(3));
+	EXPECT_EQ(252, tree.rank(501));
+
+	std::vector<int> present = { 7, 4 };
+	EXPECT_THROW(tree.insert_range(present.begin(), present.end()), std::invalid_argument);
+	EXPECT_FALSE(tree.has(7));
+}
+
+TEST_F(avl_tree_test, insertRangeIntoSingleItemTreeRebuilds) {
+	tree.insert(0);
+	std::vector<int> keys = { 1, 2, 3, 4, 5 };
+	tree.insert_range(keys.begin(), keys.end());
+
+	// A rebuild splits the items evenly; inserting them one by one would give 3 1 0 2 4 5.
+	EXPECT_EQ(tree.pre_order(), std::initializer_list<int>({ 3, 1, 0, 2, 5, 4 }));
+}
+
+TEST_F(avl_tree_test, insertMovesRvalues) {
+	avl_tree<tracked> items;
+	tracked first(42), second(13);
+	tracked::copies = tracked::moves = 0;
+
+	items.insert(std::move(first));
+	items.insert(std::move(second));
+	EXPECT_EQ(0, tracked::copies);
+	EXPECT_EQ(2, tracked::moves);
+	EXPECT_TRUE(items.has(tracked(13)));
+}
+
+TEST_F(avl_tree_test, emplaceBuildsInPlace) {
+	avl_tree<tracked> items;
+	tracked::copies = tracked::moves = 0;
+
+	items.emplace(42);
+	items.emplace(13);
+	EXPECT_EQ(0, tracked::copies);
+	EXPECT_EQ(0, tracked::moves);
+	EXPECT_TRUE(items.has(tracked(42)));
+	EXPECT_THROW(items.emplace(42), std::exception);
+	EXPECT_EQ(2, items.size());
+}
+
+TEST_F(avl_tree_test, minAndMaxAreTheEnds) {
+	EXPECT_THROW(tree.min(), std::out_of_range);
+	EXPECT_THROW(tree.max(), std::out_of_range);
+
+	for (int key : { 42, 13, 1963, 7, 99 })
+		tree.insert(key);
+	EXPECT_EQ(7, tree.min());
+	EXPECT_EQ(1963, tree.max());
+}
+
+TEST_F(avl_tree_test, popMinAndMaxDrainInOrder) {
+	EXPECT_THROW(tree.pop_min(), std::out_of_range);
+	EXPECT_THROW(tree.pop_max(), std::out_of_range);
+
+	for (int i = 1; i <= 7; ++i)
+		tree.insert(i);
+	EXPECT_EQ(1, tree.pop_min());
+	EXPECT_EQ(7, tree.pop_max());
+	EXPECT_EQ(2, tree.pop_min());
+	EXPECT_EQ(4, tree.size());
+	EXPECT_EQ(3, tree.select(0));
+	EXPECT_EQ(1, tree.rank(4));
+
+	EXPECT_EQ(6, tree.pop_max());
+	EXPECT_EQ(5, tree.pop_max());
+	EXPECT_EQ(4, tree.pop_max());
+	EXPECT_EQ(3, tree.pop_max());
+	EXPECT_EQ(0, tree.size());
+	EXPECT_EQ(tree.end(), tree.begin());
+}
+
+TEST_F(avl_tree_test, popMinKeepsBalanceAndOrder) {
+	std::set<int> reference;
+	std::mt19937 random(7);
+	for (int i = 0; i < 5000; ++i) {
+		int key = random() % 100000;
+		if (reference.insert(key).second)
+			tree.insert(key);
+		if (i % 3 == 0) {
+			ASSERT_EQ(*reference.begin(), tree.pop_min());
+			reference.erase(reference.begin());
+		} else if (i % 3 == 1) {
+			ASSERT_EQ(*reference.rbegin(), tree.pop_max());
+			reference.erase(std::prev(reference.end()));
+		}
+		ASSERT_EQ(reference.size(), tree.size());
+	}
+
+	std::vector<int> expected(reference.begin(), reference.end());
+	std::vector<int> keys(tree.begin(), tree.end());
+	EXPECT_EQ(expected, keys);
+	for (std::size_t k = 0; k < expected.size(); ++k)
+		ASSERT_EQ(expected[k], tree.select(k));
+}
+
+TEST_F(avl_tree_test, visitorsFollowTraversalOrders) {
+	for (int i = 1; i <= 7; ++i)
+		tree.insert(i);
+
+	std::vector<int> in_order, pre_order, post_order;
+	EXPECT_TRUE(tree.for_each_in_order([&](int key) { in_order.push_back(key); }));
+	EXPECT_TRUE(tree.for_each_pre_order([&](int key) { pre_order.push_back(key); }));
+	EXPECT_TRUE(tree.for_each_post_order([&](int key) { post_order.push_back(key); }));
+
+	EXPECT_EQ(std::vector<int>({ 1, 2, 3, 4, 5, 6, 7 }), in_order);
+	EXPECT_EQ(std::vector<int>({ 4, 2, 1, 3, 6, 5, 7 }), pre_order);
+	EXPECT_EQ(std::vector<int>({ 1, 3, 2, 5, 7, 6, 4 }), post_order);
+}
+
+TEST_F(avl_tree_test, visitorsStopEarly) {
+	for (int i = 1; i <= 7; ++i)
+		tree.insert(i);
+
+	std::vector<int> keys;
+	EXPECT_FALSE(tree.for_each_in_order([&](int key) {
+		keys.push_back(key);
+		return key < 3;
+	}));
+	EXPECT_EQ(std::vector<int>({ 1, 2, 3 }), keys);
+
+	keys.clear();
+	EXPECT_FALSE(tree.for_each_pre_order([&](int key) {
+		keys.push_back(key);
+		return keys.size() < 2;
+	}));
+	EXPECT_EQ(std::vector<int>({ 4, 2 }), keys);
+
+	EXPECT_TRUE(tree.for_each_post_order([](int) { return true; }));
+	EXPECT_TRUE(avl_tree<int>().for_each_in_order([](int) { return false; }));
+}
+
+TEST_F(avl_tree_test, rangeVisitorIsInclusive) {
+	for (int key = 0; key < 100; key += 10)
+		tree.insert(key);
+
+	std::vector<int> keys;
+	auto collect = [&](int key) { keys.push_back(key); };
+	EXPECT_TRUE(tree.for_each_in_range(15, 50, collect));
+	EXPECT_EQ(std::vector<int>({ 20, 30, 40, 50 }), keys);
+
+	keys.clear();
+	tree.for_each_in_range(-5, 5, collect);
+	tree.for_each_in_range(91, 200, collect);
+	tree.for_each_in_range(50, 40, collect);
+	EXPECT_EQ(std::vector<int>({ 0 }), keys);
+
+	keys.clear();
+	EXPECT_FALSE(tree.for_each_in_range(0, 90, [&](int key) {
+		keys.push_back(key);
+		return key < 30;
+	}));
+	EXPECT_EQ(std::vector<int>({ 0, 10, 20, 30 }), keys);
+}
+
+TEST_F(avl_tree_test, visitorsDoNotCopyItems) {
+	avl_tree<tracked> items;
+	for (int key : { 3, 1, 2 })
+		items.emplace(key);
+	tracked::copies = tracked::moves = 0;
+
+	int sum = 0;
+	items.for_each_in_order([&](const tracked& item) { sum += item.value; });
+	items.for_each_in_range(tracked(1), tracked(2), [&](const tracked& item) { sum += item.value; });
+	EXPECT_EQ(9, sum);
+	EXPECT_EQ(0, tracked::copies);
 }
@@ -0,0 +1,601 @@
+#ifndef B_TREE_H_
+#define B_TREE_H_
+
+#include <algorithm>
+#include <climits>
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "abstract/tree.h"
+#include "linked/doubly_linked_list/doubly_linked_list.h"
+
+#if defined(__SSE2__) && !defined(DATA_STRUCTURES_NO_SIMD)
+#include <immintrin.h>
+#define B_TREE_SIMD
+#endif
+
+namespace data_structures {
+namespace trees {
+
+using abstract::static_tree;
+using linked::doubly_linked_list;
+
+/**
+ * Search within the sorted keys of a single node. Counting smaller keys is
+ * all a node lookup needs: it is the slot of a key in a leaf, and counting
+ * keys not greater than it gives the child to descend into.
+ */
+template<typename T>
+struct b_tree_search {
+	static std::size_t count_less(const T* keys, std::size_t n, const T& key) {
+		return std::lower_bound(keys, keys + n, key) - keys;
+	}
+
+	static std::size_t count_less_equal(const T* keys, std::size_t n, const T& key) {
+		return std::upper_bound(keys, keys + n, key) - keys;
+	}
+};
+
+#ifdef B_TREE_SIMD
+/**
+ * For int keys whole blocks are compared at once, stopping at the first
+ * block that holds a key past the searched one, since keys are sorted.
+ */
+template<>
+struct b_tree_search<int> {
+	static std::size_t count_less(const int* keys, std::size_t n, int key) {
+		std::size_t i = 0;
+#ifdef __AVX2__
+		const __m256i wide = _mm256_set1_epi32(key);
+		for (; i + 8 <= n; i += 8) {
+			__m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys + i));
+			int mask = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(wide, block)));
+			if (mask != 0xff)
+				return i + __builtin_popcount(mask);
+		}
+#endif
+		const __m128i narrow = _mm_set1_epi32(key);
+		for (; i + 4 <= n; i += 4) {
+			__m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(keys + i));
+			int mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(narrow, block)));
+			if (mask != 0xf)
+				return i + __builtin_popcount(mask);
+		}
+		while (i < n && keys[i] < key)
+			++i;
+		return i;
+	}
+
+	static std::size_t count_less_equal(const int* keys, std::size_t n, int key) {
+		std::size_t i = 0;
+#ifdef __AVX2__
+		const __m256i wide = _mm256_set1_epi32(key);
+		for (; i + 8 <= n; i += 8) {
+			__m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys + i));
+			int mask = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(block, wide)));
+			if (mask != 0)
+				return i + 8 - __builtin_popcount(mask);
+		}
+#endif
+		const __m128i narrow = _mm_set1_epi32(key);
+		for (; i + 4 <= n; i += 4) {
+			__m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(keys + i));
+			int mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(block, narrow)));
+			if (mask != 0)
+				return i + 4 - __builtin_popcount(mask);
+		}
+		while (i < n && !(key < keys[i]))
+			++i;
+		return i;
+	}
+};
+#endif
+
+/**
+ * B+tree: every item lives in a leaf, internal nodes only hold copies of
+ * keys to route lookups, and leaves are chained for in-order scans.
+ *
+ * NodeSize is the byte budget of a node, a multiple of the cache line,
+ * from which the fanout is derived. Items must be default constructible,
+ * since nodes hold plain arrays of them.
+ */
+template<typename T, template<typename...> class Container = doubly_linked_list,
+		std::size_t NodeSize = 256>
+class b_tree: public static_tree<b_tree<T, Container, NodeSize>, T, Container> {
+	static_assert(std::is_default_constructible<T>::value,
+			"b_tree items must be default constructible.");
+
+	using size_type = std::size_t;
+	using search = b_tree_search<T>;
+
+	static constexpr size_type leaf_header = sizeof(size_type) + 2 * sizeof(void*);
+	static constexpr size_type inner_header = sizeof(size_type) + sizeof(void*);
+	static constexpr size_type leaf_fit =
+			(NodeSize > leaf_header) ? (NodeSize - leaf_header) / sizeof(T) : 0;
+	static constexpr size_type inner_fit =
+			(NodeSize > inner_header) ? (NodeSize - inner_header) / (sizeof(T) + sizeof(void*)) : 0;
+
+public:
+	/**< Items per leaf and routing keys per internal node, never fewer than four */
+	static constexpr size_type leaf_capacity = (leaf_fit < 4) ? 4 : leaf_fit;
+	static constexpr size_type inner_capacity = (inner_fit < 4) ? 4 : inner_fit;
+
+private:
+	static constexpr size_type min_leaf = leaf_capacity / 2;
+	static constexpr size_type min_inner = inner_capacity / 2;
+
+	/**< Every inner level at least triples the item count, so 64 levels are plenty */
+	static constexpr size_type max_depth = sizeof(size_type) * CHAR_BIT;
+
+	struct node {
+		size_type _count { 0 };
+	};
+
+	struct leaf: node {
+		leaf* _prev { nullptr };
+		leaf* _next { nullptr };
+		T _keys[leaf_capacity];
+	};
+
+	struct internal: node {
+		node* _children[inner_capacity + 1];
+		T _keys[inner_capacity];
+	};
+
+	template<typename Item>
+	static void insert_at(Item* items, size_type count, size_type position, Item item) {
+		std::move_backward(items + position, items + count, items + count + 1);
+		items[position] = std::move(item);
+	}
+
+	template<typename Item>
+	static void erase_at(Item* items, size_type count, size_type position) {
+		std::move(items + position + 1, items + count, items + position);
+	}
+
+	class iterator_base {
+	public:
+		using iterator_category = std::bidirectional_iterator_tag;
+		using value_type = T;
+		using difference_type = std::ptrdiff_t;
+		using pointer = const T*;
+		using reference = const T&;
+
+		iterator_base(leaf* ptr, size_type index, const b_tree* tree) :
+				_ptr(ptr), _index(index), _tree(tree) {
+		}
+
+		iterator_base& operator++() {
+			if (_ptr == nullptr)
+				throw std::out_of_range("Iterating beyond tree end.");
+			if (++_index == _ptr->_count) {
+				_ptr = _ptr->_next;
+				_index = 0;
+			}
+			return *this;
+		}
+
+		iterator_base operator++(int) {
+			iterator_base old = *this;
+			++(*this);
+			return old;
+		}
+
+		iterator_base& operator--() {
+			if (_ptr == nullptr) {
+				_ptr = _tree->_last;
+				_index = (_ptr != nullptr) ? _ptr->_count - 1 : 0;
+			} else if (_index == 0) {
+				_ptr = _ptr->_prev;
+				_index = (_ptr != nullptr) ? _ptr->_count - 1 : 0;
+			} else {
+				--_index;
+			}
+			return *this;
+		}
+
+		iterator_base operator--(int) {
+			iterator_base old = *this;
+			--(*this);
+			return old;
+		}
+
+		bool operator==(const iterator_base& other) const {
+			return _ptr == other._ptr && _index == other._index;
+		}
+
+		bool operator!=(const iterator_base& other) const {
+			return !(*this == other);
+		}
+
+		const T& operator*() const {
+			return _ptr->_keys[_index];
+		}
+
+		const T* operator->() const {
+			return &(_ptr->_keys[_index]);
+		}
+
+	private:
+		leaf* _ptr;
+		size_type _index;
+		const b_tree* _tree;
+	};
+
+	/**< Descends to the leaf where item belongs, recording the way down */
+	leaf* find_leaf(const T& item, internal** path, size_type* slots) const {
+		node* current = _root;
+		for (size_type level = 0; level < _depth; ++level) {
+			internal* inner = static_cast<internal*>(current);
+			size_type slot = search::count_less_equal(inner->_keys, inner->_count, item);
+			if (path != nullptr) {
+				path[level] = inner;
+				slots[level] = slot;
+			}
+			current = inner->_children[slot];
+		}
+		return static_cast<leaf*>(current);
+	}
+
+	/**< Splits a full leaf around item, returning the new right sibling */
+	leaf* split(leaf* target, size_type position, T&& item) {
+		leaf* right = new leaf;
+		const size_type half = (leaf_capacity + 1) / 2;
+
+		if (position < half) {
+			std::move(target->_keys + half - 1, target->_keys + leaf_capacity, right->_keys);
+			right->_count = leaf_capacity - half + 1;
+			target->_count = half - 1;
+			insert_at(target->_keys, target->_count++, position, std::move(item));
+		} else {
+			std::move(target->_keys + half, target->_keys + leaf_capacity, right->_keys);
+			right->_count = leaf_capacity - half;
+			target->_count = half;
+			insert_at(right->_keys, right->_count++, position - half, std::move(item));
+		}
+
+		right->_next = target->_next;
+		right->_prev = target;
+		if (target->_next != nullptr)
+			target->_next->_prev = right;
+		else
+			_last = right;
+		target->_next = right;
+		return right;
+	}
+
+	/**
+	 * Adds key and the child to its right into a full internal node, then
+	 * splits it. The middle key is returned through key, to go one level up.
+	 */
+	internal* split(internal* inner, size_type slot, T& key, node* child) {
+		T keys[inner_capacity + 1];
+		node* children[inner_capacity + 2];
+		std::move(inner->_keys, inner->_keys + inner_capacity, keys);
+		std::copy(inner->_children, inner->_children + inner_capacity + 1, children);
+		insert_at(keys, inner_capacity, slot, std::move(key));
+		insert_at(children, inner_capacity + 1, slot + 1, child);
+
+		const size_type middle = (inner_capacity + 1) / 2;
+		internal* right = new internal;
+		inner->_count = middle;
+		right->_count = inner_capacity - middle;
+		std::move(keys, keys + middle, inner->_keys);
+		std::copy(children, children + middle + 1, inner->_children);
+		std::move(keys + middle + 1, keys + inner_capacity + 1, right->_keys);
+		std::copy(children + middle + 1, children + inner_capacity + 2, right->_children);
+
+		key = std::move(keys[middle]);
+		return right;
+	}
+
+	void unlink(leaf* target) {
+		if (target->_prev != nullptr)
+			target->_prev->_next = target->_next;
+		else
+			_first = target->_next;
+		if (target->_next != nullptr)
+			target->_next->_prev = target->_prev;
+		else
+			_last = target->_prev;
+		delete target;
+	}
+
+	/**< Drops the key at slot and the child to its right from an internal node */
+	void erase_child(internal* inner, size_type slot) {
+		erase_at(inner->_keys, inner->_count, slot);
+		erase_at(inner->_children, inner->_count + 1, slot + 1);
+		--inner->_count;
+	}
+
+	/**< Refills a leaf below the minimum from a sibling, or merges them */
+	void rebalance(leaf* target, internal* parent, size_type slot) {
+		leaf* left = (slot > 0) ? static_cast<leaf*>(parent->_children[slot - 1]) : nullptr;
+		leaf* right = (slot < parent->_count) ? static_cast<leaf*>(parent->_children[slot + 1]) : nullptr;
+
+		if (left != nullptr && left->_count > min_leaf) {
+			insert_at(target->_keys, target->_count++, 0, std::move(left->_keys[--left->_count]));
+			parent->_keys[slot - 1] = target->_keys[0];
+		} else if (right != nullptr && right->_count > min_leaf) {
+			target->_keys[target->_count++] = std::move(right->_keys[0]);
+			erase_at(right->_keys, right->_count--, 0);
+			parent->_keys[slot] = right->_keys[0];
+		} else if (left != nullptr) {
+			std::move(target->_keys, target->_keys + target->_count, left->_keys + left->_count);
+			left->_count += target->_count;
+			unlink(target);
+			erase_child(parent, slot - 1);
+		} else {
+			std::move(right->_keys, right->_keys + right->_count, target->_keys + target->_count);
+			target->_count += right->_count;
+			unlink(right);
+			erase_child(parent, slot);
+		}
+	}
+
+	/**< Same for internal nodes, rotating keys through the parent */
+	void rebalance(internal* target, internal* parent, size_type slot) {
+		internal* left = (slot > 0) ? static_cast<internal*>(parent->_children[slot - 1]) : nullptr;
+		internal* right = (slot < parent->_count) ? static_cast<internal*>(parent->_children[slot + 1]) : nullptr;
+
+		if (left != nullptr && left->_count > min_inner) {
+			insert_at(target->_keys, target->_count, 0, std::move(parent->_keys[slot - 1]));
+			insert_at(target->_children, target->_count + 1, 0, left->_children[left->_count]);
+			++target->_count;
+			parent->_keys[slot - 1] = std::move(left->_keys[--left->_count]);
+		} else if (right != nullptr && right->_count > min_inner) {
+			target->_keys[target->_count] = std::move(parent->_keys[slot]);
+			target->_children[++target->_count] = right->_children[0];
+			parent->_keys[slot] = std::move(right->_keys[0]);
+			erase_at(right->_keys, right->_count, 0);
+			erase_at(right->_children, right->_count + 1, 0);
+			--right->_count;
+		} else {
+			if (left == nullptr) {
+				left = target;
+				target = right;
+				++slot;
+			}
+			left->_keys[left->_count] = std::move(parent->_keys[slot - 1]);
+			std::move(target->_keys, target->_keys + target->_count, left->_keys + left->_count + 1);
+			std::copy(target->_children, target->_children + target->_count + 1,
+					left->_children + left->_count + 1);
+			left->_count += target->_count + 1;
+			delete target;
+			erase_child(parent, slot - 1);
+		}
+	}
+
+	void destroy(node* root, size_type level) {
+		if (level < _depth) {
+			internal* inner = static_cast<internal*>(root);
+			for (size_type i = 0; i <= inner->_count; ++i)
+				destroy(inner->_children[i], level + 1);
+			delete inner;
+		} else {
+			delete static_cast<leaf*>(root);
+		}
+	}
+
+	template<typename Range>
+	static Container<T> collect(const Range& range) {
+		Container<T> container;
+		for (const T& item : range)
+			container.push_back(item);
+		return container;
+	}
+
+	using self = b_tree<T, Container, NodeSize>;
+
+public:
+	b_tree() = default;
+
+	b_tree(const self& other) {
+		for (const T& item : other)
+			insert(item);
+	}
+
+	b_tree(self&& other) {
+		swap(*this, other);
+	}
+
+	~b_tree() {
+		if (_root != nullptr)
+			destroy(_root, 0);
+	}
+
+	bool has(const T& item) const {
+		if (_root == nullptr)
+			return false;
+
+		leaf* target = find_leaf(item, nullptr, nullptr);
+		size_type position = search::count_less(target->_keys, target->_count, item);
+		return position < target->_count && !(item < target->_keys[position]);
+	}
+
+	size_type size() const {
+		return _size;
+	}
+
+	void insert(const T& item) {
+		insert(T(item));
+	}
+
+	void insert(T&& item) {
+		if (_root == nullptr)
+			_root = _first = _last = new leaf;
+
+		internal* path[max_depth];
+		size_type slots[max_depth];
+		leaf* target = find_leaf(item, path, slots);
+
+		size_type position = search::count_less(target->_keys, target->_count, item);
+		// TODO: find a better exception to throw.
+		if (position < target->_count && !(item < target->_keys[position]))
+			throw std::exception();
+
+		++_size;
+		if (target->_count < leaf_capacity) {
+			insert_at(target->_keys, target->_count++, position, std::move(item));
+			return;
+		}
+
+		// Splits travel up while they land on full nodes.
+		node* child = split(target, position, std::move(item));
+		T key = static_cast<leaf*>(child)->_keys[0];
+		for (size_type level = _depth; level-- > 0;) {
+			internal* inner = path[level];
+			if (inner->_count < inner_capacity) {
+				insert_at(inner->_keys, inner->_count, slots[level], std::move(key));
+				insert_at(inner->_children, inner->_count + 1, slots[level] + 1, child);
+				++inner->_count;
+				return;
+			}
+			child = split(inner, slots[level], key, child);
+		}
+
+		// The root itself split, so the tree grows one level.
+		internal* root = new internal;
+		root->_count = 1;
+		root->_keys[0] = std::move(key);
+		root->_children[0] = _root;
+		root->_children[1] = child;
+		_root = root;
+		++_depth;
+	}
+
+	void remove(const T& item) {
+		internal* path[max_depth];
+		size_type slots[max_depth];
+
+		// If the item is not in this tree, we have an exception.
+		if (_root == nullptr)
+			throw std::exception();
+		leaf* target = find_leaf(item, path, slots);
+		size_type position = search::count_less(target->_keys, target->_count, item);
+		if (position == target->_count || item < target->_keys[position])
+			throw std::exception();
+
+		erase_at(target->_keys, target->_count--, position);
+		--_size;
+
+		// Routing keys may still hold the removed item; they keep routing right.
+		if (_depth == 0) {
+			if (target->_count == 0) {
+				delete target;
+				_root = _first = _last = nullptr;
+			}
+			return;
+		}
+
+		if (target->_count >= min_leaf)
+			return;
+
+		rebalance(target, path[_depth - 1], slots[_depth - 1]);
+		for (size_type level = _depth - 1; level > 0 && path[level]->_count < min_inner; --level)
+			rebalance(path[level], path[level - 1], slots[level - 1]);
+
+		// A root left with a single child hands the root over to it.
+		internal* root = static_cast<internal*>(_root);
+		if (root->_count == 0) {
+			_root = root->_children[0];
+			delete root;
+			--_depth;
+		}
+	}
+
+	/**
+	 * Internal nodes only hold routing copies, so pre-order and post-order
+	 * visit the leaves left to right and coincide with in_order().
+	 */
+	Container<T> in_order() const {
+		return collect(*this);
+	}
+
+	Container<T> pre_order() const {
+		return collect(*this);
+	}
+
+	Container<T> post_order() const {
+		return collect(*this);
+	}
+
+	/**< In-order iterators, walking the chained leaves */
+	using iterator = iterator_base;
+	using const_iterator = iterator;
+
+	iterator begin() const {
+		return {_first, 0, this};
+	}
+
+	iterator end() const {
+		return {nullptr, 0, this};
+	}
+
+	iterator rbegin() const {
+		return {_last, (_last != nullptr) ? _last->_count - 1 : 0, this};
+	}
+
+	iterator rend() const {
+		return {nullptr, 0, this};
+	}
+
+	/**< First item not smaller than item, where range scans start */
+	iterator lower_bound(const T& item) const {
+		if (_root == nullptr)
+			return end();
+
+		leaf* target = find_leaf(item, nullptr, nullptr);
+		size_type position = search::count_less(target->_keys, target->_count, item);
+		if (position == target->_count)
+			return {target->_next, 0, this};
+		return {target, position, this};
+	}
+
+	/**< First item greater than item */
+	iterator upper_bound(const T& item) const {
+		if (_root == nullptr)
+			return end();
+
+		leaf* target = find_leaf(item, nullptr, nullptr);
+		size_type position = search::count_less_equal(target->_keys, target->_count, item);
+		if (position == target->_count)
+			return {target->_next, 0, this};
+		return {target, position, this};
+	}
+
+	self& operator=(self rhs) {
+		swap(*this, rhs);
+		return *this;
+	}
+
+	friend void swap(self& a, self& b) {
+		using std::swap;
+
+		swap(a._root, b._root);
+		swap(a._first, b._first);
+		swap(a._last, b._last);
+		swap(a._depth, b._depth);
+		swap(a._size, b._size);
+	}
+
+private:
+	node* _root { nullptr };
+	leaf* _first { nullptr };
+	leaf* _last { nullptr };
+	size_type _depth { 0 };
+	size_type _size { 0 };
+};
+
+template<typename T, template<typename...> class Container, std::size_t NodeSize>
+constexpr std::size_t b_tree<T, Container, NodeSize>::leaf_capacity;
+
+template<typename T, template<typename...> class Container, std::size_t NodeSize>
+constexpr std::size_t b_tree<T, Container, NodeSize>::inner_capacity;
+
+}
+}
+
+#endif /* B_TREE_H_ */
@@ -0,0 +1,149 @@
+#include <gtest/gtest.h>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+#include "b_tree.h"
+
+using data_structures::trees::b_tree;
+
+class b_tree_test: public testing::Test {
+public:
+	b_tree<int> tree;
+
+	/**< Smallest fanout, so a few dozen items already build several levels */
+	b_tree<int, data_structures::linked::doubly_linked_list, 16> narrow;
+};
+
+TEST_F(b_tree_test, isCreatedEmpty) {
+	EXPECT_EQ(0, tree.size());
+	EXPECT_FALSE(tree.has(42));
+	EXPECT_EQ(tree.end(), tree.begin());
+}
+
+TEST_F(b_tree_test, fanoutFollowsNodeSize) {
+	EXPECT_EQ(4, narrow.leaf_capacity);
+	EXPECT_EQ(4, narrow.inner_capacity);
+	EXPECT_LT(16, tree.leaf_capacity);
+}
+
+TEST_F(b_tree_test, insert) {
+	tree.insert(42);
+	tree.insert(13);
+	tree.insert(1963);
+	EXPECT_EQ(3, tree.size());
+	EXPECT_TRUE(tree.has(42));
+	EXPECT_TRUE(tree.has(13));
+	EXPECT_TRUE(tree.has(1963));
+	EXPECT_FALSE(tree.has(7));
+}
+
+TEST_F(b_tree_test, remove) {
+	tree.insert(42);
+	tree.remove(42);
+	EXPECT_FALSE(tree.has(42));
+	EXPECT_EQ(0, tree.size());
+}
+
+TEST_F(b_tree_test, repeatedInsertionThrows) {
+	tree.insert(42);
+	EXPECT_THROW(tree.insert(42), std::exception);
+}
+
+TEST_F(b_tree_test, valueNotPresentRemovalThrows) {
+	EXPECT_THROW(tree.remove(42), std::exception);
+	tree.insert(13);
+	EXPECT_THROW(tree.remove(42), std::exception);
+}
+
+TEST_F(b_tree_test, traversalsAreOrdered) {
+	for (int key : { 42, 13, 1963, 7 })
+		tree.insert(key);
+
+	EXPECT_EQ(tree.in_order(), std::initializer_list<int>({ 7, 13, 42, 1963 }));
+	EXPECT_EQ(tree.pre_order(), std::initializer_list<int>({ 7, 13, 42, 1963 }));
+	EXPECT_EQ(tree.post_order(), std::initializer_list<int>({ 7, 13, 42, 1963 }));
+}
+
+TEST_F(b_tree_test, splitsKeepOrder) {
+	for (int i = 100; i > 0; --i)
+		narrow.insert(i);
+
+	EXPECT_EQ(100, narrow.size());
+	int expected = 1;
+	for (int key : narrow)
+		EXPECT_EQ(expected++, key);
+	for (int i = 1; i <= 100; ++i)
+		EXPECT_TRUE(narrow.has(i));
+}
+
+TEST_F(b_tree_test, backwardIteratorRegress) {
+	for (int i = 0; i < 50; ++i)
+		narrow.insert(i);
+
+	int expected = 49;
+	for (auto it = narrow.rbegin(); it != narrow.rend(); --it)
+		EXPECT_EQ(expected--, *it);
+	EXPECT_EQ(-1, expected);
+	EXPECT_EQ(49, *--narrow.end());
+}
+
+TEST_F(b_tree_test, boundsStartRangeScans) {
+	for (int i = 0; i < 100; i += 10)
+		narrow.insert(i);
+
+	EXPECT_EQ(30, *narrow.lower_bound(30));
+	EXPECT_EQ(40, *narrow.upper_bound(30));
+	EXPECT_EQ(40, *narrow.lower_bound(31));
+	EXPECT_EQ(narrow.end(), narrow.lower_bound(91));
+	EXPECT_EQ(narrow.end(), narrow.upper_bound(90));
+
+	std::vector<int> scanned(narrow.lower_bound(25), narrow.upper_bound(60));
+	EXPECT_EQ(std::vector<int>({ 30, 40, 50, 60 }), scanned);
+}
+
+TEST_F(b_tree_test, randomOperationsMatchStdSet) {
+	std::set<int> reference;
+	std::mt19937 random(42);
+	std::uniform_int_distribution<int> keys(0, 999);
+
+	for (int i = 0; i < 20000; ++i) {
+		int key = keys(random);
+		if (reference.count(key)) {
+			narrow.remove(key);
+			reference.erase(key);
+		} else {
+			narrow.insert(key);
+			reference.insert(key);
+		}
+		ASSERT_EQ(reference.size(), narrow.size());
+	}
+
+	EXPECT_TRUE(std::equal(reference.begin(), reference.end(), narrow.begin()));
+	for (int key = 0; key < 1000; ++key)
+		EXPECT_EQ(reference.count(key) == 1, narrow.has(key));
+
+	for (int key : reference)
+		narrow.remove(key);
+	EXPECT_EQ(0, narrow.size());
+	EXPECT_EQ(narrow.end(), narrow.begin());
+}
+
+TEST_F(b_tree_test, copyConstructIsCreatedCorrect) {
+	for (int i = 0; i < 50; ++i)
+		narrow.insert(i);
+
+	auto copy = narrow;
+	narrow.remove(10);
+	EXPECT_EQ(50, copy.size());
+	EXPECT_TRUE(copy.has(10));
+	EXPECT_TRUE(std::equal(copy.begin(), copy.end(), narrow.begin()) == false);
+}
+
+TEST_F(b_tree_test, worksWithNonSimdKeys) {
+	b_tree<std::string> strings;
+	for (auto key : { "lorem", "ipsum", "dolor", "sit", "amet" })
+		strings.insert(key);
+	strings.remove("sit");
+	EXPECT_EQ(strings.in_order(), std::initializer_list<std::string>({ "amet", "dolor", "ipsum", "lorem" }));
+}
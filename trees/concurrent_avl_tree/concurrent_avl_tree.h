@@ -0,0 +1,792 @@
+#ifndef CONCURRENT_AVL_TREE_H_
+#define CONCURRENT_AVL_TREE_H_
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include "abstract/tree.h"
+#include "linked/doubly_linked_list/doubly_linked_list.h"
+#include "memory/epoch/epoch.h"
+
+namespace data_structures {
+namespace trees {
+
+using abstract::static_tree;
+using linked::doubly_linked_list;
+
+/**
+ * AVL tree safe to share between threads, after Bronson, Casper, Chafi and
+ * Olukotun, "A Practical Concurrent Binary Search Tree".
+ *
+ * Lookups take no locks. They descend hand-over-hand, validating each step
+ * against the version of the node they came from, and back up only when a
+ * rotation shrank that node under them. Writers lock just the nodes they
+ * change. Removing an item whose node has two children leaves a routing node
+ * behind, unlinked later once it is down to one child. A single writer
+ * keeps the tree strictly balanced; concurrent writers relax that slightly,
+ * as heights read during a rotation may already be stale, and every later
+ * write walks its whole path and mends what it finds.
+ *
+ * Unlinked nodes are reclaimed through an epoch domain from whichever thread
+ * gets there, so the allocator must be thread-safe; pool_allocator is not.
+ * Traversals see every item present throughout, but are not atomic.
+ */
+template<typename T, template<typename...> class Container = doubly_linked_list,
+		typename Allocator = std::allocator<T>>
+class concurrent_avl_tree: public static_tree<concurrent_avl_tree<T, Container, Allocator>, T, Container> {
+	using size_type = std::size_t;
+	using version_type = std::uint64_t;
+
+private:
+	/**< Test-and-test-and-set lock, small enough to live in every node */
+	class spin_lock {
+	public:
+		void lock() {
+			while (_locked.exchange(true, std::memory_order_acquire))
+				while (_locked.load(std::memory_order_relaxed))
+					std::this_thread::yield();
+		}
+
+		void unlock() {
+			_locked.store(false, std::memory_order_release);
+		}
+
+	private:
+		std::atomic<bool> _locked { false };
+	};
+
+	using lock_guard = std::lock_guard<spin_lock>;
+
+	/**
+	 * Versions only change when a node is unlinked or shrunk by a rotation,
+	 * the two events that can hide items from a lookup passing through it.
+	 */
+	enum : version_type {
+		unlinked = 1, shrinking = 2, shrink_count = 4
+	};
+
+	/**< What a node needs, when it does not need a new height */
+	enum {
+		unlink_required = -1, rebalance_required = -2, nothing_required = -3
+	};
+
+	enum class outcome {
+		absent, present, retry
+	};
+
+	struct node;
+
+	/**
+	 * Everything a node has but its item, so the holder above the root needs
+	 * no T. Children are always nodes, while parents may be the holder.
+	 */
+	struct link {
+		link(link* parent, bool present) :
+				_version(0), _height(1), _present(present), _parent(parent), _left(nullptr), _right(nullptr) {
+		}
+
+		std::atomic<version_type> _version;
+		std::atomic<int> _height;
+		std::atomic<bool> _present;
+		std::atomic<link*> _parent;
+		std::atomic<node*> _left;
+		std::atomic<node*> _right;
+		spin_lock _lock;
+	};
+
+	struct node: link {
+		template<typename... Args>
+		node(link* parent, Args&&... args) :
+				link(parent, true), _item(std::forward<Args>(args)...) {
+		}
+
+		const T _item;
+	};
+
+	using guard = memory::epoch_domain::guard;
+
+	static int height(const link* root) {
+		return root == nullptr ? 0 : root->_height.load();
+	}
+
+	static node* child(const link* root, int direction) {
+		return direction < 0 ? root->_left.load() : root->_right.load();
+	}
+
+	static void set_child(link* root, int direction, node* next) {
+		if (direction < 0)
+			root->_left.store(next);
+		else
+			root->_right.store(next);
+	}
+
+	static int compare(const T& a, const T& b) {
+		return a < b ? -1 : b < a ? 1 : 0;
+	}
+
+	/**< Rotations shrink a node under its lock, so taking it waits them out */
+	static void wait_until_not_shrinking(node* root) {
+		if ((root->_version.load() & shrinking) != 0) {
+			lock_guard lock(root->_lock);
+		}
+	}
+
+	outcome attempt_has(const T& item, const link* parent, int direction, version_type version) const {
+		while (true) {
+			node* next = child(parent, direction);
+
+			// Whatever we read is only good if parent did not shrink meanwhile.
+			if (parent->_version.load() != version)
+				return outcome::retry;
+			if (next == nullptr)
+				return outcome::absent;
+
+			int next_direction = compare(item, next->_item);
+			if (next_direction == 0)
+				return next->_present.load() ? outcome::present : outcome::absent;
+
+			version_type next_version = next->_version.load();
+			if ((next_version & shrinking) != 0) {
+				wait_until_not_shrinking(next);
+			} else if (next_version != unlinked && next == child(parent, direction)) {
+				if (parent->_version.load() != version)
+					return outcome::retry;
+				outcome result = attempt_has(item, next, next_direction, next_version);
+				if (result != outcome::retry)
+					return result;
+			}
+		}
+	}
+
+	/**
+	 * Counts the item before it becomes visible, so a concurrent remove of
+	 * it can never take the count below zero, and takes it back if the
+	 * insert does not happen.
+	 */
+	template<typename Item>
+	void counted_insert(Item&& item) {
+		++_size;
+		outcome result;
+		try {
+			result = update(std::forward<Item>(item), true);
+		} catch (...) {
+			--_size;
+			throw;
+		}
+
+		// If the value is already there, we have an exception.
+		if (result == outcome::present) {
+			--_size;
+			throw std::exception();
+		}
+	}
+
+	/**< Sets the presence of item, returning what it was before; item is only moved from into a new node */
+	template<typename Item>
+	outcome update(Item&& item, bool present) {
+		auto pinned = _epochs.pin();
+		while (true) {
+			node* root = _holder._right.load();
+			if (root == nullptr) {
+				if (!present)
+					return outcome::absent;
+
+				lock_guard lock(_holder._lock);
+				if (_holder._right.load() == nullptr) {
+					_holder._right.store(create_node(&_holder, std::forward<Item>(item)));
+					return outcome::absent;
+				}
+			} else {
+				version_type version = root->_version.load();
+				if ((version & (shrinking | unlinked)) != 0) {
+					wait_until_not_shrinking(root);
+				} else if (root == _holder._right.load()) {
+					outcome result = attempt_update(std::forward<Item>(item), present, &_holder, root, version, pinned);
+					if (result != outcome::retry)
+						return result;
+				}
+			}
+		}
+	}
+
+	template<typename Item>
+	outcome attempt_update(Item&& item, bool present, link* parent, node* root, version_type version,
+			guard& pinned) {
+		int direction = compare(item, root->_item);
+		if (direction == 0)
+			return attempt_node_update(present, parent, root, pinned);
+
+		while (true) {
+			node* next = child(root, direction);
+			if (root->_version.load() != version)
+				return outcome::retry;
+
+			if (next == nullptr) {
+				if (!present)
+					return outcome::absent;
+
+				link* damaged;
+				{
+					lock_guard lock(root->_lock);
+					if (root->_version.load() != version)
+						return outcome::retry;
+					// Another insert got here first, look again from root.
+					if (child(root, direction) != nullptr)
+						continue;
+					set_child(root, direction, create_node(root, std::forward<Item>(item)));
+					damaged = fix_height(root);
+				}
+				fix_height_and_rebalance(damaged, pinned);
+				return outcome::absent;
+			}
+
+			version_type next_version = next->_version.load();
+			if ((next_version & shrinking) != 0) {
+				wait_until_not_shrinking(next);
+			} else if (next_version != unlinked && next == child(root, direction)) {
+				if (root->_version.load() != version)
+					return outcome::retry;
+				outcome result = attempt_update(std::forward<Item>(item), present, root, next, next_version, pinned);
+				if (result != outcome::retry)
+					return result;
+			}
+		}
+	}
+
+	outcome attempt_node_update(bool present, link* parent, node* root, guard& pinned) {
+		if (!present) {
+			if (!root->_present.load())
+				return outcome::absent;
+
+			// A node with a single child can go right away, which needs the parent locked.
+			if (root->_left.load() == nullptr || root->_right.load() == nullptr) {
+				link* damaged;
+				{
+					lock_guard parent_lock(parent->_lock);
+					if (parent->_version.load() == unlinked || root->_parent.load() != parent)
+						return outcome::retry;
+
+					lock_guard lock(root->_lock);
+					if (!root->_present.load())
+						return outcome::absent;
+					if (!attempt_unlink(parent, root, pinned))
+						return outcome::retry;
+					damaged = fix_height(parent);
+				}
+				fix_height_and_rebalance(damaged, pinned);
+				return outcome::present;
+			}
+		}
+
+		lock_guard lock(root->_lock);
+		if (root->_version.load() == unlinked)
+			return outcome::retry;
+		// Unlinking may have become possible, and that takes the parent lock.
+		if (!present && (root->_left.load() == nullptr || root->_right.load() == nullptr))
+			return outcome::retry;
+		return root->_present.exchange(present) ? outcome::present : outcome::absent;
+	}
+
+	/**< Splices out root, which must have at most one child; parent and root are locked */
+	bool attempt_unlink(link* parent, node* root, guard& pinned) {
+		node* parent_left = parent->_left.load();
+		if (parent_left != root && parent->_right.load() != root)
+			return false;
+
+		node* left = root->_left.load();
+		node* right = root->_right.load();
+		if (left != nullptr && right != nullptr)
+			return false;
+
+		// Lookups inside root keep going through its old children.
+		node* splice = left != nullptr ? left : right;
+		if (parent_left == root)
+			parent->_left.store(splice);
+		else
+			parent->_right.store(splice);
+		if (splice != nullptr)
+			splice->_parent.store(parent);
+
+		root->_version.store(unlinked);
+		root->_present.store(false);
+		pinned.retire(root, reclaim, this);
+		return true;
+	}
+
+	/**< A fresh height for root, or what else it needs */
+	static int condition(const link* root) {
+		node* left = root->_left.load();
+		node* right = root->_right.load();
+		if ((left == nullptr || right == nullptr) && !root->_present.load())
+			return unlink_required;
+
+		int left_height = height(left);
+		int right_height = height(right);
+		int balance = left_height - right_height;
+		if (balance < -1 || balance > 1)
+			return rebalance_required;
+
+		int replacement = 1 + std::max(left_height, right_height);
+		return root->_height.load() != replacement ? replacement : nothing_required;
+	}
+
+	/**
+	 * Fixes the height of a locked node, returning the next node to look at:
+	 * root itself when it needs more than that, its parent when its height
+	 * changed, or nullptr when root is fine.
+	 */
+	static link* fix_height(link* root) {
+		int c = condition(root);
+		switch (c) {
+		case unlink_required:
+		case rebalance_required:
+			return root;
+		case nothing_required:
+			return nullptr;
+		default:
+			root->_height.store(c);
+			return root->_parent.load();
+		}
+	}
+
+	/**
+	 * Repairs damage from root all the way up to the holder. Healthy nodes
+	 * are checked without locks, and going past them mends heights left
+	 * stale where concurrent repairs crossed each other.
+	 */
+	void fix_height_and_rebalance(link* root, guard& pinned) {
+		while (root != nullptr && root->_parent.load() != nullptr) {
+			int c = condition(root);
+			link* next = root;
+			if (c == nothing_required || root->_version.load() == unlinked) {
+				next = nullptr;
+			} else if (c != unlink_required && c != rebalance_required) {
+				lock_guard lock(root->_lock);
+				next = fix_height(root);
+			} else {
+				link* parent = root->_parent.load();
+				lock_guard parent_lock(parent->_lock);
+				if (parent->_version.load() != unlinked && root->_parent.load() == parent) {
+					lock_guard lock(root->_lock);
+					next = rebalance(parent, static_cast<node*>(root), pinned);
+				}
+			}
+			// Unlinked nodes keep their last parent, so this always leads up.
+			root = next != nullptr ? next : root->_parent.load();
+		}
+	}
+
+	/**< Unlinks or rotates a locked node whose locked parent is parent */
+	link* rebalance(link* parent, node* root, guard& pinned) {
+		node* left = root->_left.load();
+		node* right = root->_right.load();
+		if ((left == nullptr || right == nullptr) && !root->_present.load()) {
+			if (attempt_unlink(parent, root, pinned))
+				return fix_height(parent);
+			return root;
+		}
+
+		int left_height = height(left);
+		int right_height = height(right);
+		int balance = left_height - right_height;
+		if (balance > 1)
+			return rebalance_to_right(parent, root, left, right_height, pinned);
+		if (balance < -1)
+			return rebalance_to_left(parent, root, right, left_height, pinned);
+
+		int replacement = 1 + std::max(left_height, right_height);
+		if (root->_height.load() != replacement) {
+			root->_height.store(replacement);
+			return fix_height(parent);
+		}
+		return nullptr;
+	}
+
+	link* rebalance_to_right(link* parent, node* root, node* left, int right_height, guard& pinned) {
+		lock_guard lock(left->_lock);
+		if (left->_height.load() - right_height <= 1)
+			return root;
+
+		node* left_right = left->_right.load();
+		int left_left_height = height(left->_left.load());
+		int left_right_height = height(left_right);
+		if (left_left_height >= left_right_height)
+			return rotate_right(parent, root, left, right_height, left_left_height, left_right, left_right_height);
+
+		{
+			lock_guard inner_lock(left_right->_lock);
+			left_right_height = left_right->_height.load();
+			if (left_left_height >= left_right_height)
+				return rotate_right(parent, root, left, right_height, left_left_height, left_right,
+						left_right_height);
+
+			int left_right_left_height = height(left_right->_left.load());
+			int balance = left_left_height - left_right_left_height;
+			if (balance >= -1 && balance <= 1)
+				return rotate_right_over_left(parent, root, left, right_height, left_left_height, left_right,
+						left_right_left_height, pinned);
+		}
+
+		// A double rotation would leave left unbalanced, so fix left first.
+		return rebalance_to_left(root, left, left_right, left_left_height, pinned);
+	}
+
+	link* rebalance_to_left(link* parent, node* root, node* right, int left_height, guard& pinned) {
+		lock_guard lock(right->_lock);
+		if (left_height - right->_height.load() >= -1)
+			return root;
+
+		node* right_left = right->_left.load();
+		int right_left_height = height(right_left);
+		int right_right_height = height(right->_right.load());
+		if (right_right_height >= right_left_height)
+			return rotate_left(parent, root, left_height, right, right_left, right_left_height, right_right_height);
+
+		{
+			lock_guard inner_lock(right_left->_lock);
+			right_left_height = right_left->_height.load();
+			if (right_right_height >= right_left_height)
+				return rotate_left(parent, root, left_height, right, right_left, right_left_height,
+						right_right_height);
+
+			int right_left_right_height = height(right_left->_right.load());
+			int balance = right_right_height - right_left_right_height;
+			if (balance >= -1 && balance <= 1)
+				return rotate_left_over_right(parent, root, left_height, right, right_left, right_right_height,
+						right_left_right_height, pinned);
+		}
+
+		return rebalance_to_right(root, right, right_left, right_right_height, pinned);
+	}
+
+	static void replace_child(link* parent, node* old_child, node* new_child) {
+		if (parent->_left.load() == old_child)
+			parent->_left.store(new_child);
+		else
+			parent->_right.store(new_child);
+		new_child->_parent.store(parent);
+	}
+
+	static void begin_shrink(node* root, version_type version) {
+		root->_version.store(version | shrinking);
+	}
+
+	static void end_shrink(node* root, version_type version) {
+		root->_version.store(version + shrink_count);
+	}
+
+	/**
+	 * Rotations run with parent, root and the child rising in its place
+	 * locked. Each one fixes what it can with the locks it holds and returns
+	 * the deepest node that is still damaged.
+	 */
+	link* rotate_right(link* parent, node* root, node* left, int right_height, int left_left_height,
+			node* left_right, int left_right_height) {
+		version_type version = root->_version.load();
+		begin_shrink(root, version);
+
+		root->_left.store(left_right);
+		if (left_right != nullptr)
+			left_right->_parent.store(root);
+		left->_right.store(root);
+		root->_parent.store(left);
+		replace_child(parent, root, left);
+
+		int root_height = 1 + std::max(left_right_height, right_height);
+		root->_height.store(root_height);
+		left->_height.store(1 + std::max(left_left_height, root_height));
+
+		end_shrink(root, version);
+
+		int root_balance = left_right_height - right_height;
+		if (root_balance < -1 || root_balance > 1)
+			return root;
+		if ((left_right == nullptr || right_height == 0) && !root->_present.load())
+			return root;
+
+		int left_balance = left_left_height - root_height;
+		if (left_balance < -1 || left_balance > 1)
+			return left;
+		if (left_left_height == 0 && !left->_present.load())
+			return left;
+
+		return fix_height(parent);
+	}
+
+	link* rotate_left(link* parent, node* root, int left_height, node* right, node* right_left,
+			int right_left_height, int right_right_height) {
+		version_type version = root->_version.load();
+		begin_shrink(root, version);
+
+		root->_right.store(right_left);
+		if (right_left != nullptr)
+			right_left->_parent.store(root);
+		right->_left.store(root);
+		root->_parent.store(right);
+		replace_child(parent, root, right);
+
+		int root_height = 1 + std::max(left_height, right_left_height);
+		root->_height.store(root_height);
+		right->_height.store(1 + std::max(root_height, right_right_height));
+
+		end_shrink(root, version);
+
+		int root_balance = right_left_height - left_height;
+		if (root_balance < -1 || root_balance > 1)
+			return root;
+		if ((right_left == nullptr || left_height == 0) && !root->_present.load())
+			return root;
+
+		int right_balance = right_right_height - root_height;
+		if (right_balance < -1 || right_balance > 1)
+			return right;
+		if (right_right_height == 0 && !right->_present.load())
+			return right;
+
+		return fix_height(parent);
+	}
+
+	link* rotate_right_over_left(link* parent, node* root, node* left, int right_height, int left_left_height,
+			node* left_right, int left_right_left_height, guard& pinned) {
+		version_type version = root->_version.load();
+		version_type left_version = left->_version.load();
+		node* left_right_left = left_right->_left.load();
+		node* left_right_right = left_right->_right.load();
+		int left_right_right_height = height(left_right_right);
+
+		begin_shrink(root, version);
+		begin_shrink(left, left_version);
+
+		root->_left.store(left_right_right);
+		if (left_right_right != nullptr)
+			left_right_right->_parent.store(root);
+		left->_right.store(left_right_left);
+		if (left_right_left != nullptr)
+			left_right_left->_parent.store(left);
+
+		left_right->_left.store(left);
+		left->_parent.store(left_right);
+		left_right->_right.store(root);
+		root->_parent.store(left_right);
+		replace_child(parent, root, left_right);
+
+		int root_height = 1 + std::max(left_right_right_height, right_height);
+		root->_height.store(root_height);
+		int left_height = 1 + std::max(left_left_height, left_right_left_height);
+		left->_height.store(left_height);
+		left_right->_height.store(1 + std::max(left_height, root_height));
+
+		end_shrink(root, version);
+		end_shrink(left, left_version);
+
+		// A routing node left with one child goes now, while its new parent is locked.
+		if ((left->_left.load() == nullptr || left->_right.load() == nullptr) && !left->_present.load()) {
+			attempt_unlink(left_right, left, pinned);
+			left_height = height(left_right->_left.load());
+			left_right->_height.store(1 + std::max(left_height, root_height));
+		}
+
+		int root_balance = left_right_right_height - right_height;
+		if (root_balance < -1 || root_balance > 1)
+			return root;
+		if ((left_right_right == nullptr || right_height == 0) && !root->_present.load())
+			return root;
+
+		int balance = left_height - root_height;
+		if (balance < -1 || balance > 1)
+			return left_right;
+
+		return fix_height(parent);
+	}
+
+	link* rotate_left_over_right(link* parent, node* root, int left_height, node* right, node* right_left,
+			int right_right_height, int right_left_right_height, guard& pinned) {
+		version_type version = root->_version.load();
+		version_type right_version = right->_version.load();
+		node* right_left_left = right_left->_left.load();
+		node* right_left_right = right_left->_right.load();
+		int right_left_left_height = height(right_left_left);
+
+		begin_shrink(root, version);
+		begin_shrink(right, right_version);
+
+		root->_right.store(right_left_left);
+		if (right_left_left != nullptr)
+			right_left_left->_parent.store(root);
+		right->_left.store(right_left_right);
+		if (right_left_right != nullptr)
+			right_left_right->_parent.store(right);
+
+		right_left->_right.store(right);
+		right->_parent.store(right_left);
+		right_left->_left.store(root);
+		root->_parent.store(right_left);
+		replace_child(parent, root, right_left);
+
+		int root_height = 1 + std::max(left_height, right_left_left_height);
+		root->_height.store(root_height);
+		int right_height = 1 + std::max(right_left_right_height, right_right_height);
+		right->_height.store(right_height);
+		right_left->_height.store(1 + std::max(root_height, right_height));
+
+		end_shrink(root, version);
+		end_shrink(right, right_version);
+
+		if ((right->_left.load() == nullptr || right->_right.load() == nullptr) && !right->_present.load()) {
+			attempt_unlink(right_left, right, pinned);
+			right_height = height(right_left->_right.load());
+			right_left->_height.store(1 + std::max(root_height, right_height));
+		}
+
+		int root_balance = right_left_left_height - left_height;
+		if (root_balance < -1 || root_balance > 1)
+			return root;
+		if ((right_left_left == nullptr || left_height == 0) && !root->_present.load())
+			return root;
+
+		int balance = right_height - root_height;
+		if (balance < -1 || balance > 1)
+			return right_left;
+
+		return fix_height(parent);
+	}
+
+	enum class order {
+		pre, in, post
+	};
+
+	void collect(const node* root, Container<T>& items, order sequence) const {
+		if (root == nullptr)
+			return;
+
+		bool present = root->_present.load();
+		if (sequence == order::pre && present)
+			items.push_back(root->_item);
+		collect(root->_left.load(), items, sequence);
+		if (sequence == order::in && present)
+			items.push_back(root->_item);
+		collect(root->_right.load(), items, sequence);
+		if (sequence == order::post && present)
+			items.push_back(root->_item);
+	}
+
+	Container<T> traverse(order sequence) const {
+		auto pinned = _epochs.pin();
+		Container<T> items;
+		collect(_holder._right.load(), items, sequence);
+		return items;
+	}
+
+	void recursive_delete(node* root) {
+		if (root != nullptr) {
+			recursive_delete(root->_left.load());
+			recursive_delete(root->_right.load());
+			destroy_node(root);
+		}
+	}
+
+	template<typename... Args>
+	node* create_node(Args&&... args) {
+		node* p = node_traits::allocate(_alloc, 1);
+		try {
+			node_traits::construct(_alloc, p, std::forward<Args>(args)...);
+		} catch (...) {
+			node_traits::deallocate(_alloc, p, 1);
+			throw;
+		}
+		return p;
+	}
+
+	void destroy_node(node* p) {
+		node_traits::destroy(_alloc, p);
+		node_traits::deallocate(_alloc, p, 1);
+	}
+
+	static void reclaim(void* p, void* context) {
+		static_cast<concurrent_avl_tree*>(context)->destroy_node(static_cast<node*>(p));
+	}
+
+	using node_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<node>;
+	using node_traits = std::allocator_traits<node_allocator>;
+
+public:
+	using allocator_type = Allocator;
+
+	concurrent_avl_tree() :
+			_holder(nullptr, false), _size(0) {
+	}
+
+	concurrent_avl_tree(const concurrent_avl_tree&) = delete;
+	concurrent_avl_tree& operator=(const concurrent_avl_tree&) = delete;
+
+	/**< Must not race with any other operation; retired nodes go with the epoch domain */
+	~concurrent_avl_tree() {
+		recursive_delete(_holder._right.load());
+	}
+
+	bool has(const T& item) const {
+		auto pinned = _epochs.pin();
+		while (true) {
+			// The holder never shrinks, so a lookup from there always settles.
+			outcome result = attempt_has(item, &_holder, 1, 0);
+			if (result != outcome::retry)
+				return result == outcome::present;
+		}
+	}
+
+	/**
+	 * Exact once writers are done, a recent count while they run: items
+	 * being inserted may already be counted, but the count never goes
+	 * below zero.
+	 */
+	size_type size() const {
+		return _size.load();
+	}
+
+	void insert(const T& item) {
+		counted_insert(item);
+	}
+
+	void insert(T&& item) {
+		counted_insert(std::move(item));
+	}
+
+	void remove(const T& item) {
+		if (update(item, false) == outcome::absent)
+			throw std::exception();
+		--_size;
+	}
+
+	/**
+	 * Routing nodes left behind by removals are skipped, so pre-order and
+	 * post-order list present items as they sit in the current shape.
+	 */
+	Container<T> in_order() const {
+		return traverse(order::in);
+	}
+
+	Container<T> pre_order() const {
+		return traverse(order::pre);
+	}
+
+	Container<T> post_order() const {
+		return traverse(order::post);
+	}
+
+private:
+	// Declared first so retired nodes still have it when the epoch domain goes.
+	node_allocator _alloc;
+	mutable memory::epoch_domain _epochs;
+	link _holder;
+	std::atomic<size_type> _size;
+};
+
+}
+}
+
+#endif /* CONCURRENT_AVL_TREE_H_ */
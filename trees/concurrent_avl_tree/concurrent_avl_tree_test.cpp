@@ -0,0 +1,200 @@
+#include <atomic>
+#include <gtest/gtest.h>
+#include <random>
+#include <set>
+#include <thread>
+#include <vector>
+#include "concurrent_avl_tree.h"
+
+using data_structures::trees::concurrent_avl_tree;
+
+class concurrent_avl_tree_test: public testing::Test {
+public:
+	/**< Runs body(t) on each of n threads and waits for all of them */
+	template<typename Body>
+	void run(int n, Body body) {
+		std::vector<std::thread> threads;
+		for (int t = 0; t < n; ++t)
+			threads.emplace_back(body, t);
+		for (auto& thread : threads)
+			thread.join();
+	}
+
+	template<typename List>
+	static std::vector<int> to_vector(List items) {
+		std::vector<int> keys;
+		for (auto key : items)
+			keys.push_back(key);
+		return keys;
+	}
+
+	concurrent_avl_tree<int> tree;
+};
+
+TEST_F(concurrent_avl_tree_test, isCreatedEmpty) {
+	EXPECT_EQ(0, tree.size());
+	EXPECT_FALSE(tree.has(42));
+}
+
+TEST_F(concurrent_avl_tree_test, insert) {
+	tree.insert(42);
+	tree.insert(13);
+	tree.insert(1963);
+	EXPECT_EQ(3, tree.size());
+	EXPECT_TRUE(tree.has(42));
+	EXPECT_TRUE(tree.has(13));
+	EXPECT_TRUE(tree.has(1963));
+}
+
+TEST_F(concurrent_avl_tree_test, remove) {
+	tree.insert(42);
+	tree.remove(42);
+	EXPECT_FALSE(tree.has(42));
+	EXPECT_EQ(0, tree.size());
+}
+
+TEST_F(concurrent_avl_tree_test, insertPresentItemThrows) {
+	tree.insert(42);
+	EXPECT_THROW(tree.insert(42), std::exception);
+	EXPECT_EQ(1, tree.size());
+}
+
+TEST_F(concurrent_avl_tree_test, removeMissingItemThrows) {
+	EXPECT_THROW(tree.remove(42), std::exception);
+	tree.insert(42);
+	tree.remove(42);
+	EXPECT_THROW(tree.remove(42), std::exception);
+}
+
+TEST_F(concurrent_avl_tree_test, traversalsSkipRoutingNodes) {
+	tree.insert(42);
+	tree.insert(13);
+	tree.insert(1963);
+
+	// 42 has two children, so its node stays behind to route lookups.
+	tree.remove(42);
+	EXPECT_FALSE(tree.has(42));
+
+	EXPECT_EQ(std::vector<int>({ 13, 1963 }), to_vector(tree.in_order()));
+	EXPECT_EQ(std::vector<int>({ 13, 1963 }), to_vector(tree.pre_order()));
+	EXPECT_EQ(std::vector<int>({ 13, 1963 }), to_vector(tree.post_order()));
+
+	tree.insert(42);
+	EXPECT_TRUE(tree.has(42));
+	EXPECT_EQ(3, tree.size());
+}
+
+TEST_F(concurrent_avl_tree_test, preOrderIsPreOrdered) {
+	for (int key = 1; key <= 7; ++key)
+		tree.insert(key);
+
+	EXPECT_EQ(std::vector<int>({ 4, 2, 1, 3, 6, 5, 7 }), to_vector(tree.pre_order()));
+}
+
+TEST_F(concurrent_avl_tree_test, randomOperationsMatchStdSet) {
+	std::set<int> reference;
+	std::mt19937 random(42);
+	std::uniform_int_distribution<int> keys(0, 499);
+
+	for (int i = 0; i < 5000; ++i) {
+		int key = keys(random);
+		if (reference.count(key)) {
+			tree.remove(key);
+			reference.erase(key);
+		} else {
+			tree.insert(key);
+			reference.insert(key);
+		}
+		ASSERT_EQ(reference.size(), tree.size());
+	}
+
+	auto in_order = tree.in_order();
+	auto expected = reference.begin();
+	for (auto key : in_order)
+		EXPECT_EQ(*expected++, key);
+	for (int key = 0; key < 500; ++key)
+		EXPECT_EQ(reference.count(key) == 1, tree.has(key));
+}
+
+TEST_F(concurrent_avl_tree_test, concurrentInsertsAllLand) {
+	const int threads = 4, per_thread = 2000;
+	run(threads, [&](int t) {
+		for (int i = 0; i < per_thread; ++i)
+			tree.insert(i * threads + t);
+	});
+
+	EXPECT_EQ(threads * per_thread, tree.size());
+	int expected = 0;
+	for (auto key : tree.in_order())
+		EXPECT_EQ(expected++, key);
+}
+
+TEST_F(concurrent_avl_tree_test, readersAlwaysFindStableItems) {
+	for (int key = 0; key < 2000; key += 2)
+		tree.insert(key);
+
+	std::atomic<bool> missed { false };
+	run(4, [&](int t) {
+		std::mt19937 random(t);
+		for (int i = 0; i < 4000; ++i) {
+			if (t % 2 == 0) {
+				// Writers churn odd keys around the even ones readers look for.
+				int key = random() % 500 * 4 + t + 1;
+				tree.insert(key);
+				tree.remove(key);
+			} else if (!tree.has(random() % 1000 * 2)) {
+				missed = true;
+			}
+		}
+	});
+
+	EXPECT_FALSE(missed);
+	EXPECT_EQ(1000, tree.size());
+}
+
+TEST_F(concurrent_avl_tree_test, concurrentRemovalsEmptyTheTree) {
+	const int threads = 4, per_thread = 2000;
+	for (int key = 0; key < threads * per_thread; ++key)
+		tree.insert(key);
+
+	run(threads, [&](int t) {
+		for (int i = 0; i < per_thread; ++i)
+			tree.remove(i * threads + t);
+	});
+
+	EXPECT_EQ(0, tree.size());
+	EXPECT_EQ(0, tree.in_order().size());
+}
+
+TEST_F(concurrent_avl_tree_test, stressSizeNeverExceedsInsertedItems) {
+	const int per_thread = 5000;
+	const std::size_t total = 2 * per_thread;
+	std::atomic<int> removers_left { 2 };
+	std::atomic<bool> overcounted { false };
+
+	run(5, [&](int t) {
+		if (t < 2) {
+			for (int i = 0; i < per_thread; ++i)
+				tree.insert(2 * i + t);
+		} else if (t < 4) {
+			// Each remover takes the keys of one inserter as soon as they land.
+			for (int i = 0; i < per_thread; ++i) {
+				int key = 2 * i + t - 2;
+				while (!tree.has(key))
+					std::this_thread::yield();
+				tree.remove(key);
+				// A count that went below zero would wrap around past total.
+				if (tree.size() > total)
+					overcounted = true;
+			}
+			--removers_left;
+		} else {
+			while (removers_left.load() > 0)
+				if (tree.size() > total)
+					overcounted = true;
+		}
+	});
+
+	EXPECT_FALSE(overcounted);
+	EXPECT_EQ(0, tree.size());
+}
@@ -0,0 +1,496 @@
+#ifndef PERSISTENT_AVL_TREE_H_
+#define PERSISTENT_AVL_TREE_H_
+
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "abstract/tree.h"
+#include "linked/doubly_linked_list/doubly_linked_list.h"
+
+namespace data_structures {
+namespace trees {
+
+using abstract::static_tree;
+using linked::doubly_linked_list;
+
+/**
+ * AVL tree whose copies are snapshots: copying shares the root in O(1),
+ * and every version stays unchanged by updates to the others. Nodes are
+ * reference counted and never change once two versions share them, so an
+ * update copies the O(log n) nodes on its way down that are still shared,
+ * and the untouched subtrees hang off both versions. A tree that shares
+ * nothing is updated in place, like avl_tree.
+ *
+ * Any number of threads may read, copy and drop versions sharing nodes, as
+ * long as each handle is written by one thread at a time: publish a
+ * snapshot, not the tree being updated. Nodes are released by whichever
+ * version lets go of them last, so the Allocator must be thread-safe and
+ * its copies interchangeable; pool_allocator is neither.
+ */
+template<typename T, template<typename...> class Container = doubly_linked_list,
+		typename Allocator = std::allocator<T>>
+class persistent_avl_tree: public static_tree<persistent_avl_tree<T, Container, Allocator>, T, Container> {
+	using size_type = std::size_t;
+
+private:
+	struct node {
+		template<typename... Args>
+		node(node* left, node* right, Args&&... args) :
+				_refs(1), _height(1), _size(1), _left(left), _right(right),
+				_item(std::forward<Args>(args)...) {
+		}
+
+		std::atomic<size_type> _refs;
+		size_type _height;
+		size_type _size;
+		node* _left;
+		node* _right;
+		T _item;
+	};
+
+	using self = persistent_avl_tree<T, Container, Allocator>;
+	using node_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<node>;
+	using node_traits = std::allocator_traits<node_allocator>;
+
+	/**< Upper bound for the height of any AVL tree whose size fits a size_type, as in avl_tree */
+	static constexpr size_type max_height = sizeof(size_type) * CHAR_BIT * 3 / 2;
+
+	std::intmax_t factor(node* root) const {
+		return (root == nullptr) ? 0 : height(root->_left) - height(root->_right);
+	}
+
+	std::intmax_t height(node* root) const {
+		return (root == nullptr) ? 0 : root->_height;
+	}
+
+	size_type size(node* root) const {
+		return (root == nullptr) ? 0 : root->_size;
+	}
+
+	void update(node* root) {
+		root->_height = std::max(height(root->_left), height(root->_right)) + 1;
+		root->_size = size(root->_left) + size(root->_right) + 1;
+	}
+
+	static node* acquire(node* p) {
+		if (p != nullptr)
+			p->_refs.fetch_add(1, std::memory_order_relaxed);
+		return p;
+	}
+
+	/**
+	 * Drops one reference to p, destroying every node nothing else refers
+	 * to anymore. Each level leaves at most one sibling pending, so a fixed
+	 * stack is enough.
+	 */
+	void release(node* p) {
+		node* pending[2 * max_height];
+		size_type count = 0;
+		if (p != nullptr)
+			pending[count++] = p;
+		while (count > 0) {
+			p = pending[--count];
+			if (p->_refs.fetch_sub(1, std::memory_order_acq_rel) != 1)
+				continue;
+			if (p->_left != nullptr)
+				pending[count++] = p->_left;
+			if (p->_right != nullptr)
+				pending[count++] = p->_right;
+			destroy_node(p);
+		}
+	}
+
+	/**
+	 * Makes the node behind a link we own ours alone, so it can change. A
+	 * node only we refer to already is; a shared one is swapped for a copy
+	 * that shares its children instead.
+	 */
+	node* unshare(node* p) {
+		if (p->_refs.load(std::memory_order_acquire) == 1)
+			return p;
+
+		node* copy = create_node(p->_left, p->_right, p->_item);
+		acquire(p->_left);
+		acquire(p->_right);
+		copy->_height = p->_height;
+		copy->_size = p->_size;
+		release(p);
+		return copy;
+	}
+
+	/**< Rotations as in avl_tree, on an owned root, making the child that moves up ours first */
+	void rotate_left(node*& root) {
+		root->_right = unshare(root->_right);
+		node* aux = root->_right;
+		root->_right = aux->_left;
+		aux->_left = root;
+		update(root);
+		update(aux);
+		root = aux;
+	}
+
+	void rotate_right(node*& root) {
+		root->_left = unshare(root->_left);
+		node* aux = root->_left;
+		root->_left = aux->_right;
+		aux->_right = root;
+		update(root);
+		update(aux);
+		root = aux;
+	}
+
+	void rebalance(node*& root) {
+		update(root);
+
+		if (factor(root) == 2) {
+			if (factor(root->_left) == -1) {
+				root->_left = unshare(root->_left);
+				rotate_left(root->_left);
+			}
+			rotate_right(root);
+		} else if (factor(root) == -2) {
+			if (factor(root->_right) == 1) {
+				root->_right = unshare(root->_right);
+				rotate_right(root->_right);
+			}
+			rotate_left(root);
+		}
+	}
+
+	/**
+	 * Inserts below an owned link, making the way down ours and rebalancing
+	 * on the way back. Throws on a repeated item before anything but copies
+	 * of the same nodes has been made, so the tree is still the same.
+	 */
+	template<typename Item>
+	void insert_at(node*& link, Item&& item) {
+		if (link == nullptr) {
+			link = create_node(nullptr, nullptr, std::forward<Item>(item));
+			return;
+		}
+
+		link = unshare(link);
+		if (link->_item > item)
+			insert_at(link->_left, std::forward<Item>(item));
+		else if (link->_item < item)
+			insert_at(link->_right, std::forward<Item>(item));
+
+		// TODO: find a better exception to throw.
+		else throw std::exception();
+		rebalance(link);
+	}
+
+	void remove_at(node*& link, const T& item) {
+		if (link == nullptr)
+			throw std::exception();
+
+		link = unshare(link);
+		node* root = link;
+		if (root->_item > item) {
+			remove_at(root->_left, item);
+		} else if (root->_item < item) {
+			remove_at(root->_right, item);
+		} else if (root->_left == nullptr || root->_right == nullptr) {
+			// With at most one child, that child takes the place of the removed node.
+			link = (root->_left != nullptr) ? root->_left : root->_right;
+			root->_left = root->_right = nullptr;
+			release(root);
+			return;
+		} else {
+			// With both children, the next item moves out of the right subtree into this node.
+			root->_item = pop_min_at(root->_right);
+		}
+		rebalance(link);
+	}
+
+	T pop_min_at(node*& link) {
+		link = unshare(link);
+		node* root = link;
+		if (root->_left != nullptr) {
+			T item = pop_min_at(root->_left);
+			rebalance(link);
+			return item;
+		}
+
+		link = root->_right;
+		root->_right = nullptr;
+		T item = std::move(root->_item);
+		release(root);
+		return item;
+	}
+
+	/**
+	 * Walks the tree in order with an explicit stack, as nodes shared
+	 * between versions can have no parent links. visit returns whether to
+	 * go on.
+	 */
+	template<typename Visit>
+	bool walk_in_order(Visit&& visit) const {
+		const node* pending[max_height];
+		size_type count = 0;
+		const node* p = _root;
+		while (p != nullptr || count > 0) {
+			for (; p != nullptr; p = p->_left)
+				pending[count++] = p;
+			p = pending[--count];
+			if (!visit(p->_item))
+				return false;
+			p = p->_right;
+		}
+		return true;
+	}
+
+	template<typename Visit>
+	void walk_pre_order(Visit&& visit) const {
+		const node* pending[2 * max_height];
+		size_type count = 0;
+		if (_root != nullptr)
+			pending[count++] = _root;
+		while (count > 0) {
+			const node* p = pending[--count];
+			visit(p->_item);
+			if (p->_right != nullptr)
+				pending[count++] = p->_right;
+			if (p->_left != nullptr)
+				pending[count++] = p->_left;
+		}
+	}
+
+	template<typename Visit>
+	void walk_post_order(Visit&& visit) const {
+		const node* pending[max_height];
+		size_type count = 0;
+		const node* last = nullptr;
+		const node* p = _root;
+		while (p != nullptr || count > 0) {
+			for (; p != nullptr; p = p->_left)
+				pending[count++] = p;
+			const node* top = pending[count - 1];
+			if (top->_right != nullptr && top->_right != last) {
+				p = top->_right;
+			} else {
+				visit(top->_item);
+				last = top;
+				--count;
+			}
+		}
+	}
+
+	/**< Calls visit on item, telling whether to go on, as in avl_tree */
+	template<typename Visit>
+	static bool proceed(Visit& visit, const T& item, std::true_type) {
+		visit(item);
+		return true;
+	}
+
+	template<typename Visit>
+	static bool proceed(Visit& visit, const T& item, std::false_type) {
+		return visit(item);
+	}
+
+	template<typename... Args>
+	node* create_node(Args&&... args) {
+		node* p = node_traits::allocate(_alloc, 1);
+		try {
+			node_traits::construct(_alloc, p, std::forward<Args>(args)...);
+		} catch (...) {
+			node_traits::deallocate(_alloc, p, 1);
+			throw;
+		}
+		return p;
+	}
+
+	void destroy_node(node* p) {
+		node_traits::destroy(_alloc, p);
+		node_traits::deallocate(_alloc, p, 1);
+	}
+
+public:
+	using allocator_type = Allocator;
+
+	persistent_avl_tree() = default;
+
+	/**< Snapshot of other in O(1), sharing every node */
+	persistent_avl_tree(const self& other) :
+			_alloc(other._alloc), _size(other._size), _root(acquire(other._root)) {
+	}
+
+	persistent_avl_tree(self&& other) :
+			persistent_avl_tree() {
+		swap(*this, other);
+	}
+
+	~persistent_avl_tree() {
+		release(_root);
+	}
+
+	bool has(const T& item) const {
+		node* root = _root;
+		while (root != nullptr) {
+			if (root->_item > item)
+				root = root->_left;
+			else if (root->_item < item)
+				root = root->_right;
+			else
+				return true;
+		}
+		return false;
+	}
+
+	size_type size() const {
+		return _size;
+	}
+
+	/**< Updates this version only, copying the O(log n) nodes it shares with others on the way */
+	void insert(const T& item) {
+		insert_at(_root, item);
+		++_size;
+	}
+
+	void insert(T&& item) {
+		insert_at(_root, std::move(item));
+		++_size;
+	}
+
+	void remove(const T& item) {
+		remove_at(_root, item);
+		--_size;
+	}
+
+	/**< Same as the copy constructor, spelled out for publishing */
+	self snapshot() const {
+		return *this;
+	}
+
+	/**< New versions with item added or taken out, leaving this one as it is */
+	self inserted(const T& item) const {
+		self version(*this);
+		version.insert(item);
+		return version;
+	}
+
+	self removed(const T& item) const {
+		self version(*this);
+		version.remove(item);
+		return version;
+	}
+
+	/**< Smallest and greatest items, in O(log n) */
+	const T& min() const {
+		if (_root == nullptr)
+			throw std::out_of_range("Empty tree.");
+		node* root = _root;
+		while (root->_left != nullptr)
+			root = root->_left;
+		return root->_item;
+	}
+
+	const T& max() const {
+		if (_root == nullptr)
+			throw std::out_of_range("Empty tree.");
+		node* root = _root;
+		while (root->_right != nullptr)
+			root = root->_right;
+		return root->_item;
+	}
+
+	/**< The k-th smallest item, counting from zero */
+	T select(size_type k) const {
+		if (k >= _size)
+			throw std::out_of_range("Out of range access.");
+
+		node* root = _root;
+		while (k != size(root->_left)) {
+			if (k < size(root->_left)) {
+				root = root->_left;
+			} else {
+				k -= size(root->_left) + 1;
+				root = root->_right;
+			}
+		}
+		return root->_item;
+	}
+
+	/**< How many items are smaller than item */
+	size_type rank(const T& item) const {
+		size_type smaller = 0;
+		node* root = _root;
+		while (root != nullptr) {
+			if (root->_item < item) {
+				smaller += size(root->_left) + 1;
+				root = root->_right;
+			} else {
+				root = root->_left;
+			}
+		}
+		return smaller;
+	}
+
+	Container<T> in_order() const {
+		Container<T> container;
+		walk_in_order([&container](const T& item) {
+			container.push_back(item);
+			return true;
+		});
+		return container;
+	}
+
+	Container<T> pre_order() const {
+		Container<T> container;
+		walk_pre_order([&container](const T& item) {
+			container.push_back(item);
+		});
+		return container;
+	}
+
+	Container<T> post_order() const {
+		Container<T> container;
+		walk_post_order([&container](const T& item) {
+			container.push_back(item);
+		});
+		return container;
+	}
+
+	/**< Streams every item in order without allocating; as in avl_tree, a visitor returning false stops it */
+	template<typename Visit>
+	bool for_each_in_order(Visit&& visit) const {
+		using never_stops = std::is_void<decltype(visit(std::declval<const T&>()))>;
+		return walk_in_order([&visit](const T& item) {
+			return proceed(visit, item, never_stops());
+		});
+	}
+
+	self& operator=(const self& rhs) {
+		self copy(rhs);
+		swap(*this, copy);
+		return *this;
+	}
+
+	self& operator=(self&& rhs) {
+		swap(*this, rhs);
+		return *this;
+	}
+
+	friend void swap(self& a, self& b) {
+		using std::swap;
+
+		swap(a._alloc, b._alloc);
+		swap(a._size, b._size);
+		swap(a._root, b._root);
+	}
+
+private:
+	node_allocator _alloc;
+	size_type _size { 0 };
+	node* _root { nullptr };
+};
+
+}
+}
+
+#endif /* PERSISTENT_AVL_TREE_H_ */
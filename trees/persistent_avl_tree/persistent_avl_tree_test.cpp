@@ -0,0 +1,256 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <mutex>
+#include <random>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+#include "persistent_avl_tree.h"
+
+using data_structures::trees::persistent_avl_tree;
+
+namespace {
+
+template<typename Tree>
+std::vector<int> items(const Tree& tree) {
+	std::vector<int> result;
+	tree.for_each_in_order([&result](int item) {
+		result.push_back(item);
+	});
+	return result;
+}
+
+template<typename Container>
+std::vector<int> as_vector(const Container& container) {
+	std::vector<int> result;
+	for (int item : container)
+		result.push_back(item);
+	return result;
+}
+
+}
+
+class persistent_avl_tree_test: public testing::Test {
+public:
+	persistent_avl_tree<int> tree;
+};
+
+TEST_F(persistent_avl_tree_test, isCreatedEmpty) {
+	EXPECT_EQ(0, tree.size());
+	EXPECT_FALSE(tree.has(42));
+}
+
+TEST_F(persistent_avl_tree_test, insert) {
+	tree.insert(42);
+	tree.insert(13);
+	tree.insert(1963);
+	EXPECT_EQ(3, tree.size());
+	EXPECT_TRUE(tree.has(42));
+	EXPECT_TRUE(tree.has(13));
+	EXPECT_TRUE(tree.has(1963));
+}
+
+TEST_F(persistent_avl_tree_test, insertDuplicateThrows) {
+	tree.insert(42);
+	tree.insert(13);
+	persistent_avl_tree<int> snapshot(tree);
+	EXPECT_THROW(tree.insert(13), std::exception);
+	EXPECT_EQ(2, tree.size());
+	EXPECT_EQ(std::vector<int>({ 13, 42 }), items(tree));
+	EXPECT_EQ(std::vector<int>({ 13, 42 }), items(snapshot));
+}
+
+TEST_F(persistent_avl_tree_test, remove) {
+	for (int i = 0; i < 10; ++i)
+		tree.insert(i);
+	tree.remove(3);
+	tree.remove(0);
+	tree.remove(7);
+	EXPECT_EQ(7, tree.size());
+	EXPECT_EQ(std::vector<int>({ 1, 2, 4, 5, 6, 8, 9 }), items(tree));
+	EXPECT_THROW(tree.remove(3), std::exception);
+	EXPECT_EQ(7, tree.size());
+}
+
+TEST_F(persistent_avl_tree_test, insertKeepsBalance) {
+	for (int i = 1; i <= 7; ++i)
+		tree.insert(i);
+	auto pre_order = tree.pre_order();
+	EXPECT_EQ(std::vector<int>({ 4, 2, 1, 3, 6, 5, 7 }), as_vector(pre_order));
+	auto post_order = tree.post_order();
+	EXPECT_EQ(std::vector<int>({ 1, 3, 2, 5, 7, 6, 4 }), as_vector(post_order));
+}
+
+TEST_F(persistent_avl_tree_test, removeKeepsBalance) {
+	for (int i = 1; i <= 7; ++i)
+		tree.insert(i);
+	persistent_avl_tree<int> snapshot(tree);
+	tree.remove(1);
+	tree.remove(3);
+	tree.remove(2);
+	auto pre_order = tree.pre_order();
+	EXPECT_EQ(std::vector<int>({ 6, 4, 5, 7 }), as_vector(pre_order));
+	auto old = snapshot.pre_order();
+	EXPECT_EQ(std::vector<int>({ 4, 2, 1, 3, 6, 5, 7 }), as_vector(old));
+}
+
+TEST_F(persistent_avl_tree_test, snapshotIsUnaffected) {
+	for (int i = 0; i < 100; ++i)
+		tree.insert(i);
+	auto snapshot = tree.snapshot();
+	for (int i = 0; i < 100; i += 2)
+		tree.remove(i);
+	tree.insert(1000);
+
+	EXPECT_EQ(100, snapshot.size());
+	EXPECT_EQ(51, tree.size());
+	for (int i = 0; i < 100; ++i) {
+		EXPECT_TRUE(snapshot.has(i));
+		EXPECT_EQ(i % 2 == 1, tree.has(i));
+	}
+	EXPECT_FALSE(snapshot.has(1000));
+	EXPECT_TRUE(tree.has(1000));
+}
+
+TEST_F(persistent_avl_tree_test, insertedAndRemovedLeaveTheTree) {
+	tree.insert(1);
+	tree.insert(2);
+	auto more = tree.inserted(3);
+	auto less = tree.removed(1);
+	EXPECT_EQ(std::vector<int>({ 1, 2 }), items(tree));
+	EXPECT_EQ(std::vector<int>({ 1, 2, 3 }), items(more));
+	EXPECT_EQ(std::vector<int>({ 2 }), items(less));
+	EXPECT_THROW(tree.inserted(2), std::exception);
+	EXPECT_THROW(tree.removed(3), std::exception);
+}
+
+TEST_F(persistent_avl_tree_test, versionsMatchSets) {
+	std::mt19937 gen(42);
+	std::uniform_int_distribution<int> key(0, 299);
+	std::vector<persistent_avl_tree<int>> versions(1);
+	std::vector<std::set<int>> expected(1);
+
+	for (int step = 0; step < 3000; ++step) {
+		std::size_t from = gen() % versions.size();
+		auto version = versions[from];
+		auto reference = expected[from];
+		int item = key(gen);
+		if (reference.count(item)) {
+			version.remove(item);
+			reference.erase(item);
+		} else {
+			version.insert(item);
+			reference.insert(item);
+		}
+		if (versions.size() < 50) {
+			versions.push_back(version);
+			expected.push_back(reference);
+		} else {
+			versions[from] = version;
+			expected[from] = reference;
+		}
+	}
+
+	for (std::size_t i = 0; i < versions.size(); ++i) {
+		ASSERT_EQ(expected[i].size(), versions[i].size());
+		EXPECT_EQ(std::vector<int>(expected[i].begin(), expected[i].end()), items(versions[i]));
+	}
+}
+
+TEST_F(persistent_avl_tree_test, minAndMax) {
+	EXPECT_THROW(tree.min(), std::out_of_range);
+	EXPECT_THROW(tree.max(), std::out_of_range);
+	for (int item : { 5, 3, 8, 1, 9 })
+		tree.insert(item);
+	EXPECT_EQ(1, tree.min());
+	EXPECT_EQ(9, tree.max());
+}
+
+TEST_F(persistent_avl_tree_test, selectAndRank) {
+	for (int i = 0; i < 50; ++i)
+		tree.insert(2 * i);
+	for (int i = 0; i < 50; ++i) {
+		EXPECT_EQ(2 * i, tree.select(i));
+		EXPECT_EQ(i, tree.rank(2 * i));
+		EXPECT_EQ(i + 1, tree.rank(2 * i + 1));
+	}
+	EXPECT_THROW(tree.select(50), std::out_of_range);
+}
+
+TEST_F(persistent_avl_tree_test, forEachInOrderStops) {
+	for (int i = 0; i < 10; ++i)
+		tree.insert(i);
+	std::vector<int> seen;
+	EXPECT_FALSE(tree.for_each_in_order([&seen](int item) {
+		seen.push_back(item);
+		return item < 4;
+	}));
+	EXPECT_EQ(std::vector<int>({ 0, 1, 2, 3, 4 }), seen);
+}
+
+TEST_F(persistent_avl_tree_test, assignment) {
+	for (int i = 0; i < 10; ++i)
+		tree.insert(i);
+	persistent_avl_tree<int> other;
+	other.insert(42);
+	other = tree;
+	tree.remove(5);
+	EXPECT_EQ(10, other.size());
+	EXPECT_TRUE(other.has(5));
+
+	persistent_avl_tree<int> moved(std::move(other));
+	EXPECT_EQ(10, moved.size());
+	EXPECT_EQ(0, other.size());
+	other = std::move(moved);
+	EXPECT_EQ(10, other.size());
+}
+
+TEST_F(persistent_avl_tree_test, movesStrings) {
+	persistent_avl_tree<std::string> strings;
+	std::string item(100, 'x');
+	strings.insert(std::move(item));
+	strings.insert(std::string(100, 'a'));
+	auto snapshot = strings;
+	strings.remove(std::string(100, 'x'));
+	EXPECT_TRUE(snapshot.has(std::string(100, 'x')));
+	EXPECT_FALSE(strings.has(std::string(100, 'x')));
+}
+
+TEST_F(persistent_avl_tree_test, readersSeeConsistentSnapshots) {
+	std::mutex lock;
+	persistent_avl_tree<int> published;
+	std::atomic<bool> done(false);
+
+	std::vector<std::thread> readers;
+	for (int r = 0; r < 3; ++r) {
+		readers.emplace_back([&]() {
+			while (!done.load()) {
+				persistent_avl_tree<int> snapshot;
+				{
+					std::lock_guard<std::mutex> guard(lock);
+					snapshot = published;
+				}
+				// The writer keeps the keys 0 to size - 1 in every published version.
+				std::size_t count = 0;
+				bool ordered = snapshot.for_each_in_order([&count](int item) {
+					return item == int(count++);
+				});
+				EXPECT_TRUE(ordered);
+				EXPECT_EQ(snapshot.size(), count);
+			}
+		});
+	}
+
+	for (int i = 0; i < 2000; ++i) {
+		tree.insert(i);
+		if (i % 10 == 0) {
+			std::lock_guard<std::mutex> guard(lock);
+			published = tree;
+		}
+	}
+	done = true;
+	for (auto& reader : readers)
+		reader.join();
+	EXPECT_EQ(2000, tree.size());
+}